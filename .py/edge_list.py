@@ -0,0 +1,32 @@
+# -*- coding: utf-8 -*-
+"""
+edge_list.py
+Чтение текстового списка рёбер, который пишут lab11 --dump и
+lab11_random --dump (GraphWriter.h).  Общий модуль скриптов plot_*.py.
+"""
+
+import networkx as nx
+
+
+def read_edge_list(path):
+    """
+    Читает граф из текстового списка рёбер (по паре "u v" в строке).
+    Строки, начинающиеся с "#" или "%", пропускаются; из строки
+    "# vertices n" берётся число вершин, чтобы не потерять изолированные.
+    """
+    G = nx.DiGraph()
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            text = line.strip()
+            if not text:
+                continue
+            if text.startswith("#"):
+                parts = text[1:].split()
+                if len(parts) == 2 and parts[0] == "vertices" and parts[1].isdigit():
+                    G.add_nodes_from(range(int(parts[1])))
+                continue
+            if text.startswith("%"):
+                continue
+            parts = text.split()
+            G.add_edge(int(parts[0]), int(parts[1]))
+    return G
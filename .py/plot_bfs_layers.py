@@ -5,9 +5,14 @@ plot_bfs_layers.py
 Строит пример обхода графа в ширину (BFS) от заданной стартовой вершины.
 Вершины раскрашиваются по номерам слоёв (расстояние по рёбрам от старта).
 Картинка сохраняется в data/png/bfs_layers.png
+
+Граф можно взять из списка рёбер, записанного программой с ключом
+--dump DIR (файл DIR/graph.txt); иначе строится встроенный учебный граф:
+    python3 .py/plot_bfs_layers.py [FILE [START]]
 """
 
 import os
+import sys
 import matplotlib.pyplot as plt
 
 try:
@@ -18,6 +23,8 @@ except ImportError:
         "    pip install networkx matplotlib"
     )
 
+from edge_list import read_edge_list
+
 
 def build_sample_graph():
     """
@@ -67,8 +74,12 @@ def bfs_layers(G: "nx.DiGraph", start: int):
 def main():
     os.makedirs("data/png", exist_ok=True)
 
-    G = build_sample_graph()
-    start_vertex = 0  # можно поменять при желании
+    if len(sys.argv) > 1:
+        G = read_edge_list(sys.argv[1])
+    else:
+        G = build_sample_graph()
+    # можно поменять вторым аргументом
+    start_vertex = int(sys.argv[2]) if len(sys.argv) > 2 else 0
 
     dist = bfs_layers(G, start_vertex)
 
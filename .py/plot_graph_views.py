@@ -7,9 +7,15 @@ plot_graph_views.py
 2) транспонированный граф;
 3) квадрат графа (рёбра для путей длины 1–2).
 Картинка сохраняется в data/png/graph_views.png
+
+Если передать каталог, записанный программой с ключом --dump DIR,
+графы читаются из graph.txt, transpose.txt и square.txt в нём;
+иначе строится встроенный учебный граф:
+    python3 .py/plot_graph_views.py [DIR]
 """
 
 import os
+import sys
 import matplotlib.pyplot as plt
 
 try:
@@ -20,6 +26,8 @@ except ImportError:
         "    pip install networkx matplotlib"
     )
 
+from edge_list import read_edge_list
+
 
 def build_sample_graph():
     """
@@ -70,14 +78,21 @@ def main():
     # Гарантируем наличие папки для картинок
     os.makedirs("data/png", exist_ok=True)
 
-    # Строим исходный граф
-    G = build_sample_graph()
-
-    # Транспонированный граф (рёбра обращены)
-    GT = G.reverse(copy=True)
-
-    # Квадрат графа
-    G2 = build_graph_square(G)
+    if len(sys.argv) > 1:
+        # Графы, посчитанные программой
+        dump_dir = sys.argv[1]
+        G = read_edge_list(os.path.join(dump_dir, "graph.txt"))
+        GT = read_edge_list(os.path.join(dump_dir, "transpose.txt"))
+        G2 = read_edge_list(os.path.join(dump_dir, "square.txt"))
+    else:
+        # Строим исходный граф
+        G = build_sample_graph()
+
+        # Транспонированный граф (рёбра обращены)
+        GT = G.reverse(copy=True)
+
+        # Квадрат графа
+        G2 = build_graph_square(G)
 
     # Общий layout, чтобы расположение вершин было похожим
     pos = nx.spring_layout(G, seed=42)
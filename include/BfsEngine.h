@@ -0,0 +1,119 @@
+// BfsEngine.h
+// Breadth‑first search engines that compute distances and a BFS tree
+// (parent array) instead of just the visit order.  The main engine is
+// direction‑optimizing: it switches between classic top‑down frontier
+// expansion and bottom‑up expansion over the transpose graph, following
+// Beamer, Asanović and Patterson, "Direction‑Optimizing Breadth‑First
+// Search" (SC 2012).  The multi‑source engine runs many BFS at once with
+// one bit per source, following Then et al., "The More the Merrier:
+// Efficient Multi‑Source Graph Traversal" (VLDB 2014).
+
+#ifndef BFSENGINE_H
+#define BFSENGINE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include "ThreadPool.h"
+
+// Result of a BFS from one start vertex.  distance[v] is the number of
+// edges on a shortest path from the start to v and parent[v] is the
+// predecessor of v on one such path.  Both are ‑1 for unreachable
+// vertices; parent[start] is ‑1 as well.
+struct BfsResult {
+    std::vector<int> distance;
+    std::vector<int> parent;
+};
+
+// Tuning parameters of the direction‑optimizing BFS.  The search goes
+// bottom‑up once the edges leaving the frontier exceed 1/alpha of the
+// edges still unexplored, and returns to top‑down once the frontier
+// holds fewer than 1/beta of all vertices.  Both must be at least 1;
+// smaller values are treated as 1.  The defaults are the values
+// recommended in the paper.
+struct BfsOptions {
+    int alpha = 15;
+    int beta = 18;
+};
+
+// Classic top‑down BFS on a CSR graph.  Serves as the reference for the
+// other engines.  O(V + E).
+BfsResult topDownBFS(const CsrView& g, int start);
+
+// Direction‑optimizing BFS.  gT must be the transpose of g; the
+// bottom‑up steps scan the in‑neighbours of every unvisited vertex and
+// stop at the first one found in the frontier.  Distances are identical
+// to topDownBFS, parents may differ but always form a valid BFS tree.
+// An invalid start vertex yields all ‑1 arrays.
+BfsResult directionOptimizingBFS(const CsrView& g, const CsrView& gT, int start,
+                                 const BfsOptions& options = BfsOptions());
+
+// Convenience overload for an adjacency‑list graph: converts g and its
+// transpose (from Graph::getTranspose) into CSR form and runs the
+// direction‑optimizing BFS.
+BfsResult directionOptimizingBFS(const Graph& g, int start,
+                                 const BfsOptions& options = BfsOptions());
+
+// Level‑synchronous parallel BFS.  Each frontier is split across the
+// threads of the pool; vertices are claimed through an atomic visited
+// bit map, every thread collects the vertices it claimed in its own next
+// frontier and the per‑thread lists are concatenated at precomputed
+// offsets without locks.  Distances are identical to topDownBFS; the
+// parent of a vertex is whichever frontier vertex claimed it first.
+BfsResult parallelBFS(const CsrView& g, int start, ThreadPool& pool);
+
+// Same as above with a temporary pool of numThreads threads (zero or
+// less selects ThreadPool::defaultThreadCount()).
+BfsResult parallelBFS(const CsrView& g, int start, int numThreads = 0);
+
+// Distances from many start vertices.  Row i of distance (numVertices
+// entries starting at i * numVertices) holds the distances from
+// sources[i], ‑1 for unreachable vertices; the row of an invalid source
+// is all ‑1.  The table takes sources.size() * numVertices ints, so for
+// many sources on a large graph prefer multiSourceReach.
+struct MultiBfsResult {
+    int numVertices = 0;
+    std::vector<int> sources;
+    std::vector<int> distance;
+
+    const int* distancesFrom(std::size_t i) const {
+        return distance.data() + i * static_cast<std::size_t>(numVertices);
+    }
+};
+
+// Summary of one BFS: the number of vertices reached (the source
+// included) and the sum of their distances, as needed for closeness
+// centrality.  Both are 0 for an invalid source.
+struct SourceReach {
+    int source = -1;
+    int reached = 0;
+    long long distanceSum = 0;
+};
+
+// Multi‑source BFS (MS‑BFS).  The sources are processed in batches of
+// 64, or of 256 when there are more than 64 sources; within a batch
+// every vertex keeps its seen / frontier / next sets as bit masks with
+// one bit per source, so the adjacency list of a vertex is scanned once
+// per level for all sources whose frontier contains it, instead of once
+// per source.  Distances are identical to topDownBFS from each source.
+// If pool is given, whole batches are distributed over its threads.
+// Memory: three masks of 8 or 32 bytes per vertex and thread, plus the
+// distance table.
+MultiBfsResult multiSourceBFS(const CsrView& g, const int* sources, std::size_t count,
+                              ThreadPool* pool = nullptr);
+
+MultiBfsResult multiSourceBFS(const CsrView& g, const std::vector<int>& sources,
+                              ThreadPool* pool = nullptr);
+
+// Same traversal as multiSourceBFS, but only the reach and distance sum
+// of every source are kept, so the memory does not grow with the number
+// of sources.  Entry i describes sources[i].
+std::vector<SourceReach> multiSourceReach(const CsrView& g, const int* sources,
+                                          std::size_t count, ThreadPool* pool = nullptr);
+
+std::vector<SourceReach> multiSourceReach(const CsrView& g, const std::vector<int>& sources,
+                                          ThreadPool* pool = nullptr);
+
+#endif // BFSENGINE_H
@@ -0,0 +1,104 @@
+// BitMatrixGraph.h
+// Directed graph stored as a bit‑packed adjacency matrix.  Uses one bit
+// per possible edge instead of one int, and implements the matrix
+// algorithms (transpose, square, BFS, universal sink) with 64‑bit word
+// operations.
+
+#ifndef BITMATRIXGRAPH_H
+#define BITMATRIXGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "GraphMatrix.h"
+#include "PowerReport.h"
+
+// The BitMatrixGraph class represents a directed graph with n vertices
+// as an n x n bit matrix.  Row i occupies wordsPerRow consecutive 64‑bit
+// words; bit (j % 64) of word (j / 64) is set if there is an edge from
+// i to j.  Bits past column n‑1 are always zero.  The algorithms give
+// exactly the same results as the corresponding GraphMatrix functions.
+class BitMatrixGraph {
+public:
+    // Construct an empty bit matrix graph with n vertices.
+    explicit BitMatrixGraph(int n);
+
+    // Convert an int matrix graph: every non‑zero entry becomes a set bit.
+    static BitMatrixGraph fromMatrix(const GraphMatrix& gm);
+
+    // Convert back into an int matrix graph with 0/1 entries.
+    GraphMatrix toMatrix() const;
+
+    // Set or clear the edge from u to v.  Out‑of‑range vertices are
+    // ignored.
+    void setEdge(int u, int v, bool present = true);
+
+    // Return true if there is an edge from u to v.  No bounds checking
+    // is performed.
+    bool hasEdge(int u, int v) const;
+
+    // Return the number of vertices.
+    int size() const;
+
+    // Return the number of 64‑bit words per row.
+    std::size_t wordsPerRow() const;
+
+    // Return a pointer to the first word of row u.
+    const std::uint64_t* row(int u) const;
+
+    // Return the number of edges (set bits) in the matrix.
+    std::size_t countEdges() const;
+
+    // Return the number of bytes used by the bit storage.
+    std::size_t memoryBytes() const;
+
+    // Compute and return the transpose of the graph.  The matrix is
+    // processed in 64 x 64 bit blocks, each transposed in registers
+    // with log2(64) rounds of masked swaps.  O(V^2 / 64 * log 64).
+    BitMatrixGraph getTranspose() const;
+
+    // Compute and return the square of the graph.  Row i of the result
+    // is row i OR'ed with row k for every edge (i, k), so each two‑step
+    // path costs V / 64 word operations instead of V int loads.  As in
+    // GraphMatrix, loops created by cycles of length two are kept.
+    // O(V * E / 64) time.
+    BitMatrixGraph squareGraph() const;
+
+    // Compute and return G^k: an edge (u, w) for every path of length
+    // one to k from u to w, so power(2) equals squareGraph().  Uses
+    // repeated squaring: partial results R_a and R_b (paths of length at
+    // most a and b) are combined as R_a | R_b | R_a * R_b with a
+    // word‑parallel boolean product, so only O(log k) products of
+    // O(V * E / 64) each are needed.  k is capped at n since longer
+    // paths add nothing new; k < 1 gives a graph without edges.
+    BitMatrixGraph power(int k, PowerReport* report = nullptr) const;
+
+    // Compute and return the transitive closure: an edge (u, w) for
+    // every path of length one or more.  Warshall's algorithm on bit
+    // rows: for each pivot k, every row containing k is OR'ed with row
+    // k.  O(V^3 / 64) word operations.
+    BitMatrixGraph transitiveClosure(PowerReport* report = nullptr) const;
+
+    // Perform BFS starting from the given start vertex and return the
+    // order in which vertices are visited (the same order as
+    // GraphMatrix::BFS).  Each explored row is masked with the unvisited
+    // set one word at a time.  O(V^2 / 64 + V).
+    std::vector<int> BFS(int start) const;
+
+    // Find a universal sink (in‑degree n‑1, out‑degree 0) or return ‑1.
+    // O(V) bit tests plus an O(V / 64) row scan.
+    int findUniversalSink() const;
+
+private:
+    std::uint64_t* rowData(int u);
+
+    // Return x | y | x * y for two matrices of the same size.
+    static BitMatrixGraph combine(const BitMatrixGraph& x, const BitMatrixGraph& y);
+
+    int n;
+    std::size_t words;
+    std::vector<std::uint64_t> bits;
+};
+
+#endif // BITMATRIXGRAPH_H
@@ -0,0 +1,129 @@
+// CompressedGraph.h
+// Directed graph with gap‑encoded, varint‑compressed neighbour lists.
+// Neighbours are decoded on the fly while they are scanned, so BFS and
+// the square run directly on the compressed form.
+
+#ifndef COMPRESSEDGRAPH_H
+#define COMPRESSEDGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+
+// Decode one unsigned LEB128 varint starting at p and advance p past it.
+inline std::uint64_t decodeVarint(const std::uint8_t*& p) {
+    std::uint64_t value = *p++;
+    if (value < 0x80) return value;
+    value &= 0x7F;
+    int shift = 7;
+    for (;;) {
+        std::uint64_t byte = *p++;
+        value |= (byte & 0x7F) << shift;
+        if (byte < 0x80) return value;
+        shift += 7;
+    }
+}
+
+// Map a zigzag‑encoded value back to a signed difference.
+inline std::int64_t unzigzag(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+// A read‑only range over the out‑neighbours of one vertex, decoded one
+// by one as the iterator advances.  Neighbours come in ascending order.
+struct CompressedNeighbours {
+    // Forward iterator holding the decoder state.
+    struct Iterator {
+        const std::uint8_t* p;
+        int remaining;
+        int value;
+
+        int operator*() const { return value; }
+        Iterator& operator++() {
+            if (--remaining > 0) value += static_cast<int>(decodeVarint(p));
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const { return remaining != other.remaining; }
+    };
+
+    const std::uint8_t* data; // first gap, after the degree
+    int count;
+    int owner;
+
+    Iterator begin() const {
+        if (count == 0) return end();
+        const std::uint8_t* p = data;
+        int first = owner + static_cast<int>(unzigzag(decodeVarint(p)));
+        return Iterator{p, count, first};
+    }
+    Iterator end() const { return Iterator{nullptr, 0, 0}; }
+    std::size_t size() const { return static_cast<std::size_t>(count); }
+};
+
+// The CompressedGraph class stores, for every vertex u, one record in a
+// byte stream: the degree d, then the sorted neighbours v_0 <= ... <=
+// v_{d‑1} as gaps — v_0 relative to u (zigzag‑encoded, since it may be
+// smaller than u) and v_i ‑ v_{i‑1} for the rest — each written as a
+// LEB128 varint (7 bits per byte, high bit = more bytes follow).  A gap
+// below 128 takes one byte instead of four, so graphs whose neighbours
+// have close IDs (see Reorder.h) shrink the most.  offsets[u] is the
+// byte position of the record of u.  Parallel edges are kept as gaps of
+// zero.  The graph is immutable; every algorithm returns a new graph.
+class CompressedGraph {
+public:
+    // Construct an empty graph with v vertices.
+    explicit CompressedGraph(int v = 0);
+
+    // Encode a CSR graph; every neighbour list is sorted first.  O(V + E
+    // log maxdeg).
+    static CompressedGraph fromCsr(const CsrView& g);
+
+    // Encode an adjacency‑list graph.
+    static CompressedGraph fromGraph(const Graph& g);
+
+    // Decode into CSR form with sorted neighbour lists.  O(V + E).
+    CsrGraph toCsrGraph() const;
+
+    // Return the number of vertices.
+    int size() const;
+
+    // Return the number of edges.
+    std::size_t numEdges() const;
+
+    // Return the out‑degree of u (decodes one varint).  No bounds
+    // checking is performed.
+    int degree(int u) const;
+
+    // Return the out‑neighbours of u, decoded lazily.  No bounds
+    // checking is performed.
+    CompressedNeighbours neighbours(int u) const;
+
+    // Return the number of bytes of the encoded lists and the offsets.
+    std::size_t memoryBytes() const;
+
+    // Perform a breadth‑first search from start and return the visit
+    // order.  Neighbours are visited in ascending order, so the order is
+    // that of CsrGraph::BFS on the same graph with sorted lists.
+    // O(V + E) plus the decoding.
+    std::vector<int> BFS(int start) const;
+
+    // Compute the square (paths of length one or two, no loops) straight
+    // from the compressed lists and return it compressed.  The same edges
+    // as Graph::squareGraph.  Runs in time proportional to the number of
+    // two‑step paths.
+    CompressedGraph squareGraph() const;
+
+private:
+    // Append the record of one vertex with the given sorted neighbours.
+    void appendRecord(int u, const int* first, const int* last);
+
+    int numVertices;
+    std::size_t edgeCount;
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint8_t> bytes;
+};
+
+#endif // COMPRESSEDGRAPH_H
@@ -0,0 +1,200 @@
+// CsrGraph.h
+// Immutable directed graph stored in compressed sparse row (CSR) form.
+// All edges live in two contiguous arrays, so neighbour scans walk
+// memory linearly instead of jumping between per‑vertex allocations.
+// Provides the same algorithms as Graph: transpose, square, BFS and
+// conversion into a simple undirected graph.
+
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "Graph.h"
+#include "PowerReport.h"
+
+class ThreadPool;
+
+// Producer of one chunk of edges for CsrGraph::fromEdgeChunks.
+using EdgeChunkSource = std::function<void(std::size_t chunk, EdgeList& out)>;
+
+// Producer of the rows of a graph that is consumed row by row, as by the
+// streaming writers of GraphWriter.h and GraphFile.h: rows(u, row) must
+// append the out‑neighbours of u to row, which comes in empty.  It is
+// called for u = 0, 1, ..., n ‑ 1 in turn.
+using RowSource = std::function<void(int u, std::vector<int>& row)>;
+
+// A read‑only range over the out‑neighbours of one vertex.  Can be used
+// directly in a range‑based for loop.
+struct NeighbourRange {
+    const int* first;
+    const int* last;
+
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+};
+
+class CsrGraph;
+
+// A non‑owning, read‑only view of CSR arrays.  The arrays may belong to
+// a CsrGraph or live anywhere else, for example in a memory‑mapped file
+// (see MappedGraph in GraphFile.h).  The algorithms in BfsEngine.h and
+// SquareEngine.h take a CsrView, so they run on either without copying.
+// A view must not outlive the storage it points to.
+struct CsrView {
+    int numVertices = 0;
+    const std::uint64_t* offsets = nullptr;
+    const int* targets = nullptr;
+
+    CsrView() = default;
+    CsrView(int v, const std::uint64_t* offs, const int* tgts)
+        : numVertices(v), offsets(offs), targets(tgts) {}
+
+    // Implicit conversion, so every CsrGraph can be passed as a view.
+    CsrView(const CsrGraph& g);
+
+    int size() const { return numVertices; }
+    std::size_t numEdges() const {
+        return numVertices > 0 ? static_cast<std::size_t>(offsets[numVertices]) : 0;
+    }
+    int degree(int u) const { return static_cast<int>(offsets[u + 1] - offsets[u]); }
+    NeighbourRange neighbours(int u) const {
+        return NeighbourRange{targets + offsets[u], targets + offsets[u + 1]};
+    }
+};
+
+// The CsrGraph class represents a directed graph in CSR form.  The
+// out‑neighbours of vertex u are targets[offsets[u]] ..
+// targets[offsets[u + 1] - 1], in the order the edges were supplied.
+// offsets has numVertices + 1 entries and uses 64‑bit values so that
+// graphs with more than 2^31 edges can be represented.  Once built the
+// graph cannot be modified; every algorithm returns a new graph.
+class CsrGraph {
+public:
+    // Construct an empty graph with v vertices and no edges.
+    explicit CsrGraph(int v = 0);
+
+    // Build a graph with v vertices from a list of directed edges using
+    // a counting sort on the source vertex.  Edges whose endpoints are
+    // out of range are dropped, like Graph::addEdge does.  The relative
+    // order of the edges leaving each vertex is preserved unless options
+    // ask for sorted or deduplicated lists.  O(V + E).
+    //
+    // If pool is given, the edge list is split into one contiguous chunk
+    // per thread.  Every thread counts the degrees of its chunk in a
+    // histogram of its own; a prefix sum over the vertices and, per
+    // vertex, over the threads gives every (thread, vertex) pair its
+    // slot range; then every thread scatters its chunk without atomics.
+    // The result is the same as the serial build.  The histograms take
+    // parts * V * 8 bytes, where the number of parts is the number of
+    // threads but at most max(1, E / V), so sparse graphs on many
+    // threads use fewer parts rather than more memory than the edges.
+    static CsrGraph fromEdges(int v, const EdgeList& edges,
+                              const EdgeBuildOptions& options = EdgeBuildOptions(),
+                              ThreadPool* pool = nullptr);
+
+    // Build a graph from edges produced chunk by chunk, without ever
+    // holding the whole edge list: generate(c, out) must append the edges
+    // of chunk c to out, the same ones in the same order on every call.
+    // Every chunk is generated twice, once for the counting pass and once
+    // for the scatter.  Thread t handles a fixed contiguous range of
+    // chunks, so the result is that of fromEdges on the concatenated
+    // chunks, whatever the number of threads.  expectedEdges, an estimate
+    // of the number of edges the chunks produce, takes the place of E in
+    // the bound on the number of histogram parts above; if it is 0 only
+    // one part is used.  Used by the generators in Generator.h.
+    static CsrGraph fromEdgeChunks(int v, std::size_t chunks, const EdgeChunkSource& generate,
+                                   const EdgeBuildOptions& options = EdgeBuildOptions(),
+                                   ThreadPool* pool = nullptr, std::uint64_t expectedEdges = 0);
+
+    // Adopt already built CSR arrays.  offsets must have v + 1
+    // non‑decreasing entries starting at 0 and ending at targets.size(),
+    // and every target must lie in [0, v); this is not checked.
+    static CsrGraph fromArrays(int v, std::vector<std::uint64_t> offsets,
+                               std::vector<int> targets);
+
+    // Convert an adjacency‑list graph into CSR form, keeping the order
+    // of every neighbour list.  O(V + E).
+    static CsrGraph fromGraph(const Graph& g);
+
+    // Convert back into an adjacency‑list graph.  O(V + E).
+    Graph toGraph() const;
+
+    // Return the number of vertices in the graph.
+    int size() const;
+
+    // Return the number of directed edges in the graph.
+    std::size_t numEdges() const;
+
+    // Return the out‑degree of vertex u.  No bounds checking is performed.
+    int degree(int u) const;
+
+    // Return the out‑neighbours of vertex u.  No bounds checking is
+    // performed.
+    NeighbourRange neighbours(int u) const;
+
+    // Return a non‑owning view of the arrays of this graph.
+    CsrView view() const;
+
+    // Return the raw offset and target arrays.
+    const std::vector<std::uint64_t>& getOffsets() const;
+    const std::vector<int>& getTargets() const;
+
+    // Compute and return the transpose of this graph with a counting
+    // sort on the target vertex.  The neighbour lists come out in the
+    // same order as Graph::getTranspose produces.  O(V + E).
+    CsrGraph getTranspose() const;
+
+    // Compute and return the square of this graph: an edge (u, w) for
+    // every path of length one or two from u to w, without loops.  The
+    // edges of every vertex appear in the same order as produced by
+    // Graph::squareGraph.  Marks are cleared through a touched list, so
+    // the cost is proportional to the number of two‑step paths rather
+    // than V per vertex.
+    CsrGraph squareGraph() const;
+
+    // Compute and return G^k: an edge (u, w) for every path of length one
+    // to k from u to w, without loops, so power(2) equals squareGraph()
+    // exactly.  Runs a BFS from every source that stops at depth k, or
+    // as soon as all other vertices have been reached.  Each row lists
+    // its targets in BFS order.  k < 1 gives a graph without edges.
+    CsrGraph power(int k, PowerReport* report = nullptr) const;
+
+    // Compute and return the transitive closure without loops: an edge
+    // (u, w) for every w != u reachable from u.  Same per‑source BFS as
+    // power() without the depth limit.  O(V * (V + E)) in the worst case.
+    CsrGraph transitiveClosure(PowerReport* report = nullptr) const;
+
+    // Perform a breadth‑first search from the given start vertex and
+    // return the order in which vertices are visited.  The order is
+    // identical to Graph::BFS.  O(V + E).
+    std::vector<int> BFS(int start) const;
+
+    // Convert the (multi)graph into a simple undirected graph: loops are
+    // removed and parallel edges collapsed.  Each neighbour list is
+    // sorted in ascending order.  Uses the same radix sort and dedup
+    // pipeline as Graph::toSimpleUndirected and allocates the output
+    // arrays exactly once.  If pool is given, key emission and sorting
+    // run in parallel.  O(V + E).
+    CsrGraph toSimpleUndirected(ThreadPool* pool = nullptr) const;
+
+private:
+    // Shared implementation of power() and transitiveClosure(); a
+    // negative depth means no limit.
+    CsrGraph boundedReach(int depth, PowerReport* report) const;
+
+    CsrGraph(int v, std::vector<std::uint64_t> offsets, std::vector<int> targets);
+
+    int numVertices;
+    std::vector<std::uint64_t> offsets;
+    std::vector<int> targets;
+};
+
+inline CsrView::CsrView(const CsrGraph& g) : CsrView(g.view()) {}
+
+#endif // CSRGRAPH_H
@@ -0,0 +1,87 @@
+// DegreeStats.h
+// Degree statistics of a directed graph computed in one pass over its
+// edges: in‑ and out‑degree arrays, the universal sink, the sources and
+// sinks, and degree histograms.  Works on adjacency lists and CSR in
+// O(V + E), so a sparse graph no longer has to be expanded into an
+// O(V^2) GraphMatrix just to look for a universal sink, and on the
+// dense matrices with the vector kernels of SimdKernels.h.
+
+#ifndef DEGREESTATS_H
+#define DEGREESTATS_H
+
+#include <cstdint>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include "GraphMatrix.h"
+
+class ThreadPool;
+
+// The statistics to compute.  Everything is requested by default; clear
+// the fields that are not needed to save the work and memory they take.
+// The in‑degrees are counted whenever inDegrees, sourcesAndSinks or
+// histograms is set.
+struct DegreeStatsRequest {
+    bool outDegrees = true;
+    bool inDegrees = true;
+    bool universalSink = true;
+    bool sourcesAndSinks = true;
+    bool histograms = true;
+};
+
+// Result of computeDegreeStats.  Fields that were not requested are
+// left empty (universalSink ‑1).  Parallel edges count once per copy and
+// a loop adds one to both degrees of its vertex.
+struct DegreeStats {
+    std::vector<int> outDegree;
+    std::vector<int> inDegree;
+    // A vertex with no out‑edges that every other vertex has an edge to,
+    // or ‑1.  There is at most one.
+    int universalSink = -1;
+    // Vertices with in‑degree 0 and with out‑degree 0, in ascending order.
+    std::vector<int> sources;
+    std::vector<int> sinks;
+    // outHistogram[d] is the number of vertices with out‑degree d, up to
+    // the largest degree; likewise inHistogram.
+    std::vector<std::uint64_t> outHistogram;
+    std::vector<std::uint64_t> inHistogram;
+};
+
+// Statistics of a CSR or adjacency‑list graph.  The out‑degrees come
+// from the list sizes.  A universal sink must be the only vertex with
+// out‑degree 0 (every other vertex has an edge to it), so that vertex is
+// the one candidate, and the edge pass that counts the in‑degrees also
+// counts the vertices whose list contains it.  If pool is given, the
+// edge pass is split into chunks of vertices handed out dynamically, and
+// every thread counts in‑degrees into an array of its own (threads * V
+// ints), which are summed afterwards; the histograms and the source and
+// sink lists are collected per thread over contiguous vertex ranges and
+// merged in order.  The result does not depend on the number of
+// threads.  O(V + E).
+DegreeStats computeDegreeStats(const CsrView& g,
+                               const DegreeStatsRequest& request = DegreeStatsRequest(),
+                               ThreadPool* pool = nullptr);
+DegreeStats computeDegreeStats(const Graph& g,
+                               const DegreeStatsRequest& request = DegreeStatsRequest(),
+                               ThreadPool* pool = nullptr);
+
+// Statistics of a dense matrix graph (GraphMatrix or ByteGraphMatrix).
+// Every row is scanned once: its non‑zero cells are counted for the
+// out‑degree and added to the column counters for the in‑degrees, both
+// with vector kernels; rows are split across the threads of pool, each
+// with its own column counters.  If only the universal sink is
+// requested, DenseGraphMatrix::findUniversalSink answers in O(V) instead
+// of O(V^2).
+template <typename Cell>
+DegreeStats computeDegreeStats(const DenseGraphMatrix<Cell>& g,
+                               const DegreeStatsRequest& request = DegreeStatsRequest(),
+                               ThreadPool* pool = nullptr);
+
+// The universal sink of a CSR or adjacency‑list graph, or ‑1: the same
+// answer as DenseGraphMatrix::findUniversalSink on the same edges, in
+// O(V + E) without building the matrix.
+int findUniversalSink(const CsrView& g, ThreadPool* pool = nullptr);
+int findUniversalSink(const Graph& g, ThreadPool* pool = nullptr);
+
+#endif // DEGREESTATS_H
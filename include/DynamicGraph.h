@@ -0,0 +1,110 @@
+// DynamicGraph.h
+// Directed multigraph that accepts edge insertions and removals and
+// keeps its transpose and its square G^2 up to date after every update,
+// so they can be queried at any time without being rebuilt.
+
+#ifndef DYNAMICGRAPH_H
+#define DYNAMICGRAPH_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+
+// The DynamicGraph class stores, for every vertex u:
+//   out[u]    — map from v to the multiplicity m(u, v) of edge (u, v);
+//   in[u]     — map from v to m(v, u): the transpose, kept in step;
+//   square[u] — map from w != u to the number of paths of length one or
+//               two from u to w, counting parallel edges separately:
+//               c(u, w) = m(u, w) + sum over v of m(u, v) * m(v, w).
+// (u, w) is an edge of G^2 exactly when c(u, w) > 0, which matches
+// Graph::squareGraph (no loops in G^2).
+//
+// Adding edge (a, b) adds to c the row of b (every path a ‑> b ‑> w) and
+// the column of a (every path x ‑> a ‑> b), both taken before the
+// update, plus the direct edge itself; removal subtracts the same terms
+// taken before the edge is removed.  An update therefore costs
+// O(|out[b]| + |in[a]|) expected time — only the neighbourhoods it
+// touches — instead of the O(V + E) or worse of rebuilding.
+class DynamicGraph {
+public:
+    using EdgeMap = std::unordered_map<int, int>;
+    using PathMap = std::unordered_map<int, long long>;
+
+    // Construct an empty graph with v vertices.
+    explicit DynamicGraph(int v);
+
+    // Build from an adjacency‑list graph by inserting its edges one by
+    // one, so parallel edges and loops are kept.
+    static DynamicGraph fromGraph(const Graph& g);
+
+    // Return the number of vertices.
+    int size() const;
+
+    // Return the number of edges, parallel edges counted separately.
+    std::size_t numEdges() const;
+
+    // Return the number of edges of G^2.
+    std::size_t numSquareEdges() const;
+
+    // Add one copy of the edge (u, v).  Out‑of‑range vertices are
+    // ignored, like Graph::addEdge does.
+    void addEdge(int u, int v);
+
+    // Remove one copy of the edge (u, v).  Returns false, changing
+    // nothing, if there is no such edge.
+    bool removeEdge(int u, int v);
+
+    // Apply a batch of updates: every edge of added is inserted, then
+    // every edge of removed is removed.  Returns the number of removals
+    // that found their edge.
+    std::size_t applyBatch(const EdgeList& added, const EdgeList& removed);
+
+    // Return the multiplicity of the edge (u, v), 0 if absent.
+    int multiplicity(int u, int v) const;
+
+    // Return true if there is a path of length one or two from u to w,
+    // u != w.
+    bool hasSquareEdge(int u, int w) const;
+
+    // Return the number of paths of length one or two from u to w
+    // (0 for u == w).
+    long long squarePathCount(int u, int w) const;
+
+    // Maintained neighbourhoods; the references stay valid until the
+    // graph is destroyed, the contents change with every update.
+    const EdgeMap& outEdges(int u) const;
+    const EdgeMap& inEdges(int u) const;
+    const PathMap& squareEdges(int u) const;
+
+    // Copy the current graph, its transpose or its square into an
+    // adjacency‑list graph.  Parallel edges appear once per copy and
+    // every neighbour list is sorted, so the results equal those of
+    // Graph::getTranspose / Graph::squareGraph up to the order within a
+    // list.  O(V + size of the result).
+    Graph toGraph() const;
+    Graph getTranspose() const;
+    Graph squareGraph() const;
+
+private:
+    // Add delta to c(u, w), dropping the entry when it reaches zero.
+    void addPaths(int u, int w, long long delta);
+
+    // Add sign times the paths created by one copy of edge (a, b), using
+    // the multiplicities currently stored.
+    void updateSquare(int a, int b, long long sign);
+
+    // Copy maps of multiplicities into sorted adjacency lists.
+    static Graph listsFrom(const std::vector<EdgeMap>& maps);
+
+    int numVertices;
+    std::size_t edgeCount;
+    std::size_t squareCount;
+    std::vector<EdgeMap> out;
+    std::vector<EdgeMap> in;
+    std::vector<PathMap> square;
+};
+
+#endif // DYNAMICGRAPH_H
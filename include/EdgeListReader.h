@@ -0,0 +1,40 @@
+// EdgeListReader.h
+// Fast parser for text edge lists (SNAP style: one "u v" pair per line,
+// '#' or '%' comment lines, blank lines allowed).  A "# vertices n"
+// comment, as written by writeEdgeList in GraphWriter.h, declares the
+// number of vertices, so isolated vertices at the end survive a
+// reload.  The input is split at line boundaries into chunks that are
+// parsed in parallel with std::from_chars, and the result is a flat
+// EdgeList ready for the bulk builder CsrGraph::fromEdges.
+
+#ifndef EDGELISTREADER_H
+#define EDGELISTREADER_H
+
+#include <cstddef>
+#include <string>
+
+#include "CsrGraph.h"
+#include "ThreadPool.h"
+
+// Parse the text in [data, data + size).  Every non‑comment line must
+// start with two integers in [0, INT_MAX), so that maxVertex + 1 is a
+// valid vertex count; anything after them on the line (for example a
+// weight column) is ignored.  Edges are appended to edges in file order
+// and maxVertex receives the largest vertex id seen, or n ‑ 1 if a
+// "# vertices n" line declares more vertices (‑1 if there are neither
+// edges nor such a line).  Returns false and fills *error (if given)
+// with the byte offset of the first malformed line.
+bool parseEdgeList(const char* data, std::size_t size, EdgeList& edges, int& maxVertex,
+                   ThreadPool& pool, std::string* error = nullptr);
+
+// Memory‑map the file at path and parse it with parseEdgeList.
+bool readEdgeListFile(const std::string& path, EdgeList& edges, int& maxVertex,
+                      ThreadPool& pool, std::string* error = nullptr);
+
+// Read the file at path and build a CSR graph from it.  The number of
+// vertices is maxVertex + 1 as set by parseEdgeList, unless numVertices
+// is positive.
+bool loadCsrGraph(const std::string& path, CsrGraph& g, ThreadPool& pool,
+                  int numVertices = 0, std::string* error = nullptr);
+
+#endif // EDGELISTREADER_H
@@ -0,0 +1,132 @@
+// Generator.h
+// Reproducible random graphs: Erdős–Rényi G(n, m), R‑MAT (the Kronecker
+// generator of Graph500) and Barabási–Albert preferential attachment.
+//
+// Randomness comes from a counter‑based generator: every edge j draws
+// from its own stream RandomStream(seed, j), whose values are a pure
+// function of (seed, j, draw index).  No generator state is shared or
+// carried from one edge to the next, so the edges can be produced in any
+// order by any number of threads and the output depends on the seed
+// only.  The *Graph functions stream the edges chunk by chunk into
+// CsrGraph::fromEdgeChunks, so the edge list is never stored.
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+
+class ThreadPool;
+
+// Finalizer of SplitMix64: a bijective mix of all 64 bits.
+inline std::uint64_t mix64(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// Return the high 64 bits of the 128‑bit product a * b, from four
+// 32 x 32 bit products (standard C++, no 128‑bit integer type).
+inline std::uint64_t mulHigh64(std::uint64_t a, std::uint64_t b) {
+    const std::uint64_t aLo = a & 0xFFFFFFFFULL;
+    const std::uint64_t aHi = a >> 32;
+    const std::uint64_t bLo = b & 0xFFFFFFFFULL;
+    const std::uint64_t bHi = b >> 32;
+    const std::uint64_t lowLow = aLo * bLo;
+    const std::uint64_t highLow = aHi * bLo;
+    const std::uint64_t lowHigh = aLo * bHi;
+    const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + lowHigh;
+    return aHi * bHi + (highLow >> 32) + (middle >> 32);
+}
+
+// Counter‑based, splittable pseudo‑random generator.  Value i of a
+// stream is mix64(key + (i + 1) * golden), where the key is derived from
+// the seed and the stream number; split() derives an independent child
+// stream.  Copying a stream copies its position.
+class RandomStream {
+public:
+    RandomStream(std::uint64_t seed, std::uint64_t stream)
+        : key(mix64(mix64(seed) ^ (stream * 0xD1B54A32D192ED03ULL))), counter(0) {}
+
+    // Return the next 64 random bits.
+    std::uint64_t next() { return mix64(key + ++counter * 0x9E3779B97F4A7C15ULL); }
+
+    // Return a value in [0, bound) for bound > 0 (multiply‑shift; the bias
+    // is below bound / 2^64).
+    std::uint64_t nextBelow(std::uint64_t bound) {
+        return mulHigh64(next(), bound);
+    }
+
+    // Return a double in [0, 1).
+    double nextDouble() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+    // Return an independent stream identified by child.
+    RandomStream split(std::uint64_t child) const { return RandomStream(key, child + 1); }
+
+private:
+    std::uint64_t key;
+    std::uint64_t counter;
+};
+
+// Quadrant probabilities of R‑MAT: at every level of the recursion the
+// edge falls into the top‑left, top‑right or bottom‑left quadrant with
+// probability a, b or c, and into the bottom‑right one otherwise.  With
+// scramble, vertex IDs are relabelled by a seeded permutation, as
+// Graph500 does, so the high‑degree vertices are not all near 0.
+struct RmatParams {
+    double a = 0.57;
+    double b = 0.19;
+    double c = 0.19;
+    bool scramble = false;
+
+    // Graph500 parameters: a, b, c = 0.57, 0.19, 0.19 with scrambled IDs.
+    // The benchmark uses 2^scale vertices and 16 edges per vertex.
+    static RmatParams graph500();
+};
+
+// Number of edges generated per chunk (and per task of the pool).
+const std::size_t kGeneratorChunk = std::size_t(1) << 16;
+
+// G(n, m): m edges with both endpoints uniform in [0, n).  Without
+// selfLoops, the target is drawn from the n ‑ 1 other vertices, so no
+// draws are rejected.  Parallel edges may occur.  Requires n > 1 if
+// selfLoops is false.
+EdgeList erdosRenyiEdges(int n, std::uint64_t m, std::uint64_t seed, bool selfLoops = true,
+                         ThreadPool* pool = nullptr);
+CsrGraph erdosRenyiGraph(int n, std::uint64_t m, std::uint64_t seed, bool selfLoops = true,
+                         const EdgeBuildOptions& options = EdgeBuildOptions(),
+                         ThreadPool* pool = nullptr);
+
+// R‑MAT with m edges on n vertices: every edge descends ceil(log2 n)
+// levels of the adjacency matrix, two levels per 64‑bit draw.  An edge
+// that lands outside [0, n)^2 (n not a power of two) is drawn again
+// from the same stream.  Loops and parallel edges are kept, as in
+// Graph500.
+EdgeList rmatEdges(int n, std::uint64_t m, const RmatParams& params, std::uint64_t seed,
+                   ThreadPool* pool = nullptr);
+CsrGraph rmatGraph(int n, std::uint64_t m, const RmatParams& params, std::uint64_t seed,
+                   const EdgeBuildOptions& options = EdgeBuildOptions(),
+                   ThreadPool* pool = nullptr);
+
+// Barabási–Albert graph with n vertices, each attaching k edges to
+// earlier vertices with probability proportional to their degree, by
+// the copy model of Batagelj and Brandes: edge j = (j / k, t_j) occupies
+// slots 2j and 2j + 1 of a virtual array of endpoints, and t_j is the
+// endpoint in a slot r drawn uniformly from [0, 2j).  An even slot holds
+// a known source; an odd slot 2i + 1 holds t_i, which is resolved the
+// same way, so every target is found by following a short chain of
+// earlier draws without storing the array.  Edges point from the newer
+// vertex to the older; loops and parallel edges may occur (edge 0 is
+// the loop (0, 0)).
+EdgeList barabasiAlbertEdges(int n, int k, std::uint64_t seed, ThreadPool* pool = nullptr);
+CsrGraph barabasiAlbertGraph(int n, int k, std::uint64_t seed,
+                             const EdgeBuildOptions& options = EdgeBuildOptions(),
+                             ThreadPool* pool = nullptr);
+
+#endif // GENERATOR_H
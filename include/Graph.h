@@ -6,9 +6,27 @@
 #ifndef GRAPH_H
 #define GRAPH_H
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 #include <queue>
-#include <unordered_set>
+
+class ThreadPool;
+class GraphWorkspace;
+
+// A flat list of directed edges (u, v).
+using EdgeList = std::vector<std::pair<int, int>>;
+
+// Post‑processing of the neighbour lists built by the bulk builders
+// Graph::fromEdges and CsrGraph::fromEdges.  By default every list keeps
+// the order in which its edges appear in the input.
+struct EdgeBuildOptions {
+    // Sort every neighbour list in ascending order.
+    bool sortNeighbours = false;
+    // Drop parallel edges, keeping one copy of each.  Duplicates are
+    // found by sorting, so the lists also come out sorted.
+    bool removeDuplicates = false;
+};
 
 // The Graph class represents a directed graph using an adjacency list.
 // Vertices are numbered from 0 to (numVertices - 1).  Edges are stored
@@ -20,12 +38,26 @@ public:
     // Construct an empty graph with v vertices.
     explicit Graph(int v);
 
-    // Add a directed edge from u to v.  No bounds checking is performed.
+    // Build a graph with v vertices from a flat edge list in one pass
+    // over the edges instead of one addEdge call per edge: the lists are
+    // built in CSR form by CsrGraph::fromEdges (in parallel if pool is
+    // given) and every one is allocated once at its final size.  Edges
+    // with out‑of‑range endpoints are dropped, as by addEdge.  O(V + E).
+    static Graph fromEdges(int v, const EdgeList& edges,
+                           const EdgeBuildOptions& options = EdgeBuildOptions(),
+                           ThreadPool* pool = nullptr);
+
+    // Add a directed edge from u to v.  Edges with an out‑of‑range end
+    // are ignored, so the lists only ever hold valid vertices.
     void addEdge(int u, int v);
 
     // Return the number of vertices in the graph.
     int size() const;
 
+    // Return the number of edges, parallel edges and loops included.
+    // O(V): the list sizes are summed.
+    std::size_t numEdges() const;
+
     // Return the adjacency list of the graph.
     const std::vector<std::vector<int>>& getAdjacencyList() const;
 
@@ -35,7 +67,8 @@ public:
 
     // Compute and return the square of this graph.  The square graph G^2
     // contains an edge (u, v) if there is a path in G from u to v of
-    // length one or two.  Runs in O(V * (V + E)) time in the worst case.
+    // length one or two.  Runs in time proportional to the number of
+    // paths of length one or two, O(V + sum of deg(u) * deg(v)).
     Graph squareGraph() const;
 
     // Perform a breadth‑first search starting from the given start vertex.
@@ -48,10 +81,29 @@ public:
     // parallel edges are collapsed into a single edge.  The result
     // contains an undirected edge (u, v) exactly once for each distinct
     // unordered pair {u, v} that appears in the original graph, with
-    // u != v.  Runs in O(V + E) time.
-    Graph toSimpleUndirected() const;
+    // u != v.  Every neighbour list is sorted, so the result is
+    // deterministic.  Each edge becomes one packed (min, max) key in a
+    // flat buffer, the keys are radix sorted and deduplicated, and the
+    // lists are filled in a single pass.  If pool is given, key emission
+    // and sorting run in parallel.  Runs in O(V + E) time.
+    Graph toSimpleUndirected(ThreadPool* pool = nullptr) const;
+
+    // Workspace overloads of the algorithms above.  They give the same
+    // results, but take their scratch memory from ws and write into out
+    // (or into ws.order for BFS), reusing the capacity left there by
+    // earlier calls; with the same workspace and outputs, repeated calls
+    // on graphs of the same size do not allocate.  Growth of out is
+    // counted in ws.stats() as well.  out must not be this graph.
+    const std::vector<int>& BFS(int start, GraphWorkspace& ws) const;
+    void getTranspose(Graph& out, GraphWorkspace& ws) const;
+    void squareGraph(Graph& out, GraphWorkspace& ws) const;
+    void toSimpleUndirected(Graph& out, GraphWorkspace& ws) const;
 
 private:
+    // Make this graph an edgeless graph with v vertices, keeping the
+    // capacity of the existing neighbour lists.
+    void resetFor(int v, GraphWorkspace& ws);
+
     int numVertices;
     std::vector<std::vector<int>> adj;
 };
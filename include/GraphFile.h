@@ -0,0 +1,103 @@
+// GraphFile.h
+// Versioned binary on‑disk format for CSR graphs and a read‑only,
+// memory‑mapped view of such a file.  Opening a file maps it into memory
+// without parsing or copying, so the algorithms in BfsEngine.h and
+// SquareEngine.h can run on it straight away through a CsrView.
+
+#ifndef GRAPHFILE_H
+#define GRAPHFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CsrGraph.h"
+
+// Current version of the file format.
+const std::uint32_t kGraphFileVersion = 1;
+
+// Fixed 32‑byte header at the start of every graph file.  It is followed
+// by (numVertices + 1) 64‑bit offsets and numEdges 32‑bit targets, in the
+// byte order of the machine that wrote the file; byteOrder lets a reader
+// detect a file written with a different byte order.
+struct GraphFileHeader {
+    char magic[8];              // "L11GRAPH"
+    std::uint32_t version;      // kGraphFileVersion
+    std::uint32_t byteOrder;    // 0x01020304 as written by the producer
+    std::uint64_t numVertices;
+    std::uint64_t numEdges;
+};
+
+// Write g to path in the binary format.  Returns false and fills *error
+// (if given) when the file cannot be written.
+bool writeGraphFile(const std::string& path, const CsrGraph& g,
+                    std::string* error = nullptr);
+
+// Write a graph produced row by row, without holding its targets: the
+// targets are streamed out behind a gap left for the header and the
+// offsets, which are filled in at the end.  Only the V + 1 offsets are
+// kept in memory.  path must be a regular, seekable file.
+bool writeGraphFile(const std::string& path, int numVertices, const RowSource& rows,
+                    std::string* error = nullptr);
+
+// The MappedGraph class is a read‑only graph backed by a memory‑mapped
+// graph file.  Pages are loaded by the operating system on first access,
+// so opening even a multi‑gigabyte file is nearly instant.  open()
+// checks the header, the file size and the first and last offsets; the
+// remaining offsets and targets are trusted unless a full check is
+// requested.
+class MappedGraph {
+public:
+    // Construct a closed graph.
+    MappedGraph();
+
+    // Unmap the file if one is open.
+    ~MappedGraph();
+
+    MappedGraph(const MappedGraph&) = delete;
+    MappedGraph& operator=(const MappedGraph&) = delete;
+    MappedGraph(MappedGraph&& other) noexcept;
+    MappedGraph& operator=(MappedGraph&& other) noexcept;
+
+    // Map the file at path.  Returns false and sets error() if the file
+    // cannot be opened or is not a valid graph file.  Any previously
+    // mapped file is closed first.  With verify set, every offset is
+    // also checked to be non‑decreasing and at most numEdges, and every
+    // target to be a vertex of the graph; this reads the whole file, but
+    // is needed before running algorithms on a file from an untrusted
+    // source, as they index per‑vertex arrays with these values.
+    bool open(const std::string& path, bool verify = false);
+
+    // Unmap the file.
+    void close();
+
+    // Return true if a file is mapped.
+    bool isOpen() const;
+
+    // Return the reason of the last failed open().
+    const std::string& error() const;
+
+    // Return the number of vertices, or 0 if no file is open.
+    int size() const;
+
+    // Return the number of edges, or 0 if no file is open.
+    std::size_t numEdges() const;
+
+    // Return the out‑neighbours of vertex u.  No bounds checking is
+    // performed.
+    NeighbourRange neighbours(int u) const;
+
+    // Return a view of the mapped arrays, valid while the file is open.
+    CsrView view() const;
+
+    // Copy the mapped graph into an owning CsrGraph.
+    CsrGraph toCsrGraph() const;
+
+private:
+    void* data;
+    std::size_t length;
+    CsrView arrays;
+    std::string lastError;
+};
+
+#endif // GRAPHFILE_H
@@ -0,0 +1,299 @@
+// GraphKernels.h
+// Graph algorithms written once as templates over the vertex ID type,
+// the storage of the graph and the bounds‑checking policy, all resolved
+// at compile time: a kernel instantiated for a CSR graph with uint32_t
+// IDs and unchecked access compiles to a plain loop over the arrays, with
+// no range tests and no virtual calls.
+//
+//   vertex IDs — int (the type of Graph and CsrGraph) or an unsigned
+//                type such as std::uint32_t, which numbers twice as many
+//                vertices in the same four bytes (lab11_bench measures
+//                it); offsets are always 64 bits, so the edge count is
+//                never the limit.
+//   storage    — ListStorage (adjacency lists, as in Graph) and
+//                CsrStorage (CSR arrays, as in CsrGraph and
+//                MappedGraph).  A storage policy is a non‑owning view
+//                with size(), degree(u) and forEachNeighbour(u, visit);
+//                storageOf() makes one for Graph and for CsrView, and
+//                ViewBase in GraphViews.h is one as well.  The matrix
+//                classes keep their own word‑ and vector‑wide loops,
+//                which a per‑neighbour policy cannot express.
+//   access     — CheckedAccess tests every vertex it reads against
+//                [0, n) and skips those outside; UncheckedAccess trusts
+//                the storage.  The classes of this project only ever
+//                hold vertices in range (their builders drop the
+//                others), so their own algorithms use UncheckedAccess;
+//                CheckedAccess is for arrays of unknown origin.
+//
+// Graph::BFS, Graph::getTranspose, Graph::squareGraph, CsrGraph::BFS,
+// CsrGraph::squareGraph and the rows of SquareView run on these kernels.
+
+#ifndef GRAPHKERNELS_H
+#define GRAPHKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include "Metrics.h"
+
+// Bounds‑checking policies.
+struct CheckedAccess {
+    static constexpr bool checked = true;
+};
+
+struct UncheckedAccess {
+    static constexpr bool checked = false;
+};
+
+// Return true if v is a vertex of a graph with n vertices.
+template <typename Id>
+inline bool vertexInRange(Id v, Id n) {
+    static_assert(std::is_integral<Id>::value, "vertex IDs must be integers");
+    if constexpr (std::is_signed<Id>::value) {
+        return v >= 0 && v < n;
+    } else {
+        return v < n;
+    }
+}
+
+// Adjacency lists: lists[u] holds the out‑neighbours of u.
+template <typename Id>
+class ListStorage {
+public:
+    using VertexId = Id;
+
+    explicit ListStorage(const std::vector<std::vector<Id>>& lists) : lists(&lists) {}
+
+    Id size() const { return static_cast<Id>(lists->size()); }
+    std::uint64_t degree(Id u) const { return (*lists)[u].size(); }
+
+    // The list of u as a range (int IDs only), for algorithms that walk
+    // a neighbour list step by step, such as an explicit DFS.
+    NeighbourRange neighbours(Id u) const {
+        const std::vector<Id>& list = (*lists)[u];
+        return NeighbourRange{list.data(), list.data() + list.size()};
+    }
+
+    template <typename Visit>
+    void forEachNeighbour(Id u, Visit&& visit) const {
+        for (Id v : (*lists)[u]) visit(v);
+    }
+
+private:
+    const std::vector<std::vector<Id>>* lists;
+};
+
+// CSR arrays: the out‑neighbours of u are targets[offsets[u]] ..
+// targets[offsets[u + 1] - 1].
+template <typename Id>
+class CsrStorage {
+public:
+    using VertexId = Id;
+
+    CsrStorage(Id numVertices, const std::uint64_t* offsets, const Id* targets)
+        : n(numVertices), offsets(offsets), targets(targets) {}
+
+    Id size() const { return n; }
+    std::uint64_t degree(Id u) const { return offsets[u + 1] - offsets[u]; }
+
+    // The targets of u as a range (int IDs only).
+    NeighbourRange neighbours(Id u) const {
+        return NeighbourRange{targets + offsets[u], targets + offsets[u + 1]};
+    }
+
+    template <typename Visit>
+    void forEachNeighbour(Id u, Visit&& visit) const {
+        const Id* last = targets + offsets[u + 1];
+        for (const Id* p = targets + offsets[u]; p != last; ++p) visit(*p);
+    }
+
+private:
+    Id n;
+    const std::uint64_t* offsets;
+    const Id* targets;
+};
+
+// Storage policies of the existing classes, all with int vertex IDs.
+using GraphStorage = ListStorage<int>;
+using CsrGraphStorage = CsrStorage<int>;
+
+inline GraphStorage storageOf(const Graph& g) {
+    return GraphStorage(g.getAdjacencyList());
+}
+
+inline CsrGraphStorage storageOf(const CsrView& g) {
+    return CsrGraphStorage(g.size(), g.offsets, g.targets);
+}
+
+// Owning CSR arrays with vertex IDs of type Id: the result of the
+// kernels that build a graph.  For Id = int, CsrGraph::fromArrays adopts
+// the arrays without copying.
+template <typename Id>
+struct CsrArrays {
+    Id numVertices = 0;
+    std::vector<std::uint64_t> offsets;
+    std::vector<Id> targets;
+
+    CsrStorage<Id> storage() const {
+        return CsrStorage<Id>(numVertices, offsets.data(), targets.data());
+    }
+};
+
+// Breadth‑first search from start; returns the vertices in the order
+// they are visited.  The output doubles as the queue.  With checked
+// access an out‑of‑range start gives an empty order and out‑of‑range
+// neighbours are skipped; with unchecked access start must be a vertex.
+// metricsName names the metrics scope of the call (see Metrics.h).
+template <typename Access = UncheckedAccess, typename Storage>
+std::vector<typename Storage::VertexId> bfsVisitOrder(const Storage& g,
+                                                      typename Storage::VertexId start,
+                                                      const char* metricsName = "bfsVisitOrder") {
+    using Id = typename Storage::VertexId;
+    LAB11_METRICS_SCOPE(metrics, metricsName);
+    (void)metricsName;
+    const Id n = g.size();
+    std::vector<Id> order;
+    if constexpr (Access::checked) {
+        if (!vertexInRange(start, n)) return order;
+    }
+    std::vector<char> visited(static_cast<std::size_t>(n), 0);
+    order.reserve(static_cast<std::size_t>(n));
+    visited[static_cast<std::size_t>(start)] = 1;
+    order.push_back(start);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        LAB11_METRICS_QUEUE(metrics, head, order.size());
+        LAB11_METRICS_EDGES(metrics, g.degree(order[head]));
+        g.forEachNeighbour(order[head], [&](Id v) {
+            if constexpr (Access::checked) {
+                if (!vertexInRange(v, n)) return;
+            }
+            char& seen = visited[static_cast<std::size_t>(v)];
+            if (!seen) {
+                seen = 1;
+                order.push_back(v);
+            }
+        });
+    }
+    return order;
+}
+
+// The in‑degree of every vertex: entry v counts the edges that end at
+// v, parallel edges included.  With checked access edges with an
+// out‑of‑range end are skipped.  O(V + E).
+template <typename Access = UncheckedAccess, typename Storage>
+std::vector<std::uint64_t> inDegrees(const Storage& g) {
+    using Id = typename Storage::VertexId;
+    const Id n = g.size();
+    std::vector<std::uint64_t> degree(static_cast<std::size_t>(n), 0);
+    for (Id u = 0; u < n; ++u) {
+        g.forEachNeighbour(u, [&](Id v) {
+            if constexpr (Access::checked) {
+                if (!vertexInRange(v, n)) return;
+            }
+            ++degree[static_cast<std::size_t>(v)];
+        });
+    }
+    return degree;
+}
+
+// Transpose by a counting sort on the target: the in‑neighbours of
+// every vertex come out in ascending order, one entry per parallel
+// edge, as in Graph::getTranspose.  With checked access edges with an
+// out‑of‑range end are dropped.  O(V + E).
+template <typename Access = UncheckedAccess, typename Storage>
+CsrArrays<typename Storage::VertexId> transposeArrays(const Storage& g) {
+    using Id = typename Storage::VertexId;
+    CsrArrays<Id> out;
+    const Id n = g.size();
+    const std::size_t count = static_cast<std::size_t>(n);
+    out.numVertices = n;
+    out.offsets.assign(count + 1, 0);
+    for (Id u = 0; u < n; ++u) {
+        g.forEachNeighbour(u, [&](Id v) {
+            if constexpr (Access::checked) {
+                if (!vertexInRange(v, n)) return;
+            }
+            ++out.offsets[static_cast<std::size_t>(v) + 1];
+        });
+    }
+    for (std::size_t v = 0; v < count; ++v) out.offsets[v + 1] += out.offsets[v];
+    out.targets.resize(out.offsets[count]);
+    std::vector<std::uint64_t> pos(out.offsets.begin(), out.offsets.end() - 1);
+    for (Id u = 0; u < n; ++u) {
+        g.forEachNeighbour(u, [&](Id v) {
+            if constexpr (Access::checked) {
+                if (!vertexInRange(v, n)) return;
+            }
+            out.targets[pos[static_cast<std::size_t>(v)]++] = u;
+        });
+    }
+    return out;
+}
+
+// Append row u of the square G^2 to row: the direct neighbours of u
+// first, then the two‑step targets, each once and without u itself, in
+// the order of CsrGraph::squareGraph.  marked has one entry per vertex,
+// all zero on entry and on return; only the entries set for this row
+// are cleared.  Returns the number of two‑step edges scanned (for
+// metrics).  With checked access out‑of‑range vertices are skipped.
+template <typename Access = UncheckedAccess, typename Storage>
+std::uint64_t appendSquareRow(const Storage& g, typename Storage::VertexId u,
+                              std::vector<char>& marked,
+                              std::vector<typename Storage::VertexId>& row) {
+    using Id = typename Storage::VertexId;
+    const Id n = g.size();
+    const std::size_t rowStart = row.size();
+    std::uint64_t scanned = 0;
+    auto add = [&](Id w) {
+        if constexpr (Access::checked) {
+            if (!vertexInRange(w, n)) return;
+        }
+        char& mark = marked[static_cast<std::size_t>(w)];
+        if (w == u || mark) return;
+        mark = 1;
+        row.push_back(w);
+    };
+    g.forEachNeighbour(u, add);
+    g.forEachNeighbour(u, [&](Id v) {
+        if constexpr (Access::checked) {
+            if (!vertexInRange(v, n)) return;
+        }
+        scanned += g.degree(v);
+        g.forEachNeighbour(v, add);
+    });
+    for (std::size_t i = rowStart; i < row.size(); ++i) {
+        marked[static_cast<std::size_t>(row[i])] = 0;
+    }
+    return scanned;
+}
+
+// The square G^2 as CSR arrays, built row by row with appendSquareRow.
+// metricsName names the metrics scope of the call (see Metrics.h).
+template <typename Access = UncheckedAccess, typename Storage>
+CsrArrays<typename Storage::VertexId> squareArrays(const Storage& g,
+                                                   const char* metricsName = "squareArrays") {
+    using Id = typename Storage::VertexId;
+    LAB11_METRICS_SCOPE(metrics, metricsName);
+    (void)metricsName;
+    CsrArrays<Id> out;
+    const Id n = g.size();
+    out.numVertices = n;
+    out.offsets.assign(static_cast<std::size_t>(n) + 1, 0);
+    std::uint64_t edges = 0;
+    for (Id u = 0; u < n; ++u) edges += g.degree(u);
+    out.targets.reserve(edges);
+    std::vector<char> marked(static_cast<std::size_t>(n), 0);
+    for (Id u = 0; u < n; ++u) {
+        std::uint64_t scanned = appendSquareRow<Access>(g, u, marked, out.targets);
+        LAB11_METRICS_EDGES(metrics, scanned);
+        (void)scanned;
+        out.offsets[static_cast<std::size_t>(u) + 1] = out.targets.size();
+    }
+    return out;
+}
+
+#endif // GRAPHKERNELS_H
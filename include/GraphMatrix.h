@@ -6,41 +6,84 @@
 #ifndef GRAPHMATRIX_H
 #define GRAPHMATRIX_H
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <queue>
 
-// The GraphMatrix class represents a directed graph using an adjacency
-// matrix.  The matrix adjMat[i][j] is non‑zero if there is an edge
+#include "AlignedAllocator.h"
+
+class ThreadPool;
+class GraphWorkspace;
+
+// Read‑only view of an n x n matrix stored row‑major in one buffer.
+// view[i] points at the first cell of row i, so view[i][j] reads the
+// same way as the old nested vectors.  The view does not own the cells
+// and is invalidated when the matrix is modified or destroyed.
+template <typename Cell>
+struct MatrixView {
+    const Cell* data;
+    std::size_t stride;
+    int n;
+
+    const Cell* operator[](int i) const { return data + static_cast<std::size_t>(i) * stride; }
+    int size() const { return n; }
+};
+
+// The DenseGraphMatrix class represents a directed graph using an
+// adjacency matrix.  The cell (i, j) is non‑zero if there is an edge
 // from i to j.  The value stored can be 1 for presence/absence; the
 // algorithms in this class only test whether an entry is zero or not.
-class GraphMatrix {
+//
+// The cells live in one 64‑byte aligned buffer; every row is padded with
+// zero cells to a multiple of 64 bytes, so rows start on a cache line and
+// the row kernels in SimdKernels.h (OR of two rows, search for a
+// non‑zero cell) can run on whole vectors.  Cell is the stored type:
+// int (GraphMatrix) or std::uint8_t (ByteGraphMatrix, four times less
+// memory).  For one bit per cell use BitMatrixGraph.
+template <typename Cell>
+class DenseGraphMatrix {
 public:
+    using CellType = Cell;
+
     // Construct an empty matrix graph with n vertices.
-    explicit GraphMatrix(int n);
+    explicit DenseGraphMatrix(int n);
 
     // Set an edge from u to v.  If value is non‑zero, the edge is
-    // considered present.  No bounds checking is performed.
+    // considered present; a value outside the range of Cell is stored
+    // as 1.  Out‑of‑range vertices are ignored.
     void setEdge(int u, int v, int value = 1);
 
     // Return the number of vertices.
     int size() const;
 
-    // Return a constant reference to the adjacency matrix.
-    const std::vector<std::vector<int>>& getMatrix() const;
+    // Return a view of the adjacency matrix: getMatrix()[i][j].
+    MatrixView<Cell> getMatrix() const;
+
+    // Return a pointer to the first cell of row u.
+    const Cell* row(int u) const;
+
+    // Return the distance in cells between the starts of two rows.
+    std::size_t stride() const;
 
     // Compute and return the transpose of the graph.  All edge
-    // directions are reversed.  Complexity: O(V^2).
-    GraphMatrix getTranspose() const;
+    // directions are reversed.  The matrix is walked in square tiles
+    // (see MatrixKernels.h); if pool is given, bands of tiles are
+    // transposed in parallel.  Complexity: O(V^2).
+    DenseGraphMatrix getTranspose(ThreadPool* pool = nullptr) const;
 
     // Compute and return the square of the graph.  In the square
     // graph G^2, an edge (u, w) is present if there is a path of
-    // length one or two from u to w in the original graph.  Runs in
-    // O(V^3) time.
-    GraphMatrix squareGraph() const;
+    // length one or two from u to w in the original graph.  Row i of
+    // the result is row i OR'ed with row k for every edge (i, k), with
+    // the OR done by a vector kernel.  Runs in O(V^3) time.
+    DenseGraphMatrix squareGraph() const;
 
     // Perform BFS starting from the given start vertex.  Returns the
-    // order in which vertices are visited.  Since this uses an
-    // adjacency matrix, the complexity is O(V^2).
+    // order in which vertices are visited.  Each explored row is
+    // searched for cells that are non‑zero and not yet visited with a
+    // vector kernel, so visited vertices are skipped a whole vector at a
+    // time.  The complexity is O(V^2).
     std::vector<int> BFS(int start) const;
 
     // Find a universal sink in the graph if one exists.  A universal
@@ -49,9 +92,33 @@ public:
     // exists.  Runs in O(V) time.
     int findUniversalSink() const;
 
+    // Workspace overloads of BFS, getTranspose and squareGraph: the same
+    // results, with scratch memory from ws and the result written into
+    // ws.order or out, reusing their capacity; repeated calls on
+    // matrices of the same size do not allocate.  out must not be this
+    // matrix.
+    const std::vector<int>& BFS(int start, GraphWorkspace& ws) const;
+    void getTranspose(DenseGraphMatrix& out, GraphWorkspace& ws) const;
+    void squareGraph(DenseGraphMatrix& out, GraphWorkspace& ws) const;
+
 private:
+    Cell* rowData(int u);
+
+    // Make this an n x n matrix of zeros, reusing the cell buffer.
+    void resetFor(int size, GraphWorkspace& ws);
+
     int n;
-    std::vector<std::vector<int>> adjMat;
+    std::size_t rowStride;
+    std::vector<Cell, AlignedAllocator<Cell, 64>> cells;
 };
 
-#endif // GRAPHMATRIX_H
\ No newline at end of file
+// Matrix of int cells; the type used by the lab programs.
+using GraphMatrix = DenseGraphMatrix<int>;
+
+// Matrix of byte cells.
+using ByteGraphMatrix = DenseGraphMatrix<std::uint8_t>;
+
+extern template class DenseGraphMatrix<int>;
+extern template class DenseGraphMatrix<std::uint8_t>;
+
+#endif // GRAPHMATRIX_H
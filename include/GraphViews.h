@@ -0,0 +1,210 @@
+// GraphViews.h
+// Lazy views of graphs derived from a base graph: the transpose, the
+// square G^2 and the simple undirected graph.  Unlike getTranspose,
+// squareGraph and toSimpleUndirected, a view builds nothing up front:
+// the neighbours of a vertex are computed the first time they are asked
+// for and kept in a bounded least‑recently‑used cache, so a few point
+// queries on a huge graph cost only the rows they touch.  materialize()
+// builds the whole derived graph when it is needed after all.
+//
+// A view reads the base graph in place (CSR arrays, a mapped file or
+// the lists of a Graph) and never copies it; the base must outlive the
+// view and must not change while the view is in use.  Views are not
+// thread safe: even neighbours() updates the cache.
+
+#ifndef GRAPHVIEWS_H
+#define GRAPHVIEWS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+
+class ThreadPool;
+
+// Counters of a row cache.
+struct ViewCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+    // Rows and targets held at the moment.
+    std::size_t rows = 0;
+    std::size_t targets = 0;
+};
+
+// Default bound of a row cache: 1M targets (4 MB).
+const std::size_t kDefaultViewCacheTargets = std::size_t(1) << 20;
+
+// The ViewBase class is the graph a view reads from: CSR arrays or the
+// adjacency lists of a Graph, behind one neighbours() call.  It is also
+// a storage policy for the kernels of GraphKernels.h.
+class ViewBase {
+public:
+    using VertexId = int;
+
+    ViewBase(const CsrView& g);
+    ViewBase(const CsrGraph& g);
+    ViewBase(const Graph& g);
+
+    int size() const { return numVertices; }
+
+    // Return the number of edges of the underlying graph.
+    std::uint64_t numEdges() const;
+
+    NeighbourRange neighbours(int u) const {
+        if (lists) {
+            const std::vector<int>& list = (*lists)[u];
+            return NeighbourRange{list.data(), list.data() + list.size()};
+        }
+        return csr.neighbours(u);
+    }
+
+    std::uint64_t degree(int u) const { return neighbours(u).size(); }
+
+    template <typename Visit>
+    void forEachNeighbour(int u, Visit&& visit) const {
+        for (int v : neighbours(u)) visit(v);
+    }
+
+private:
+    int numVertices;
+    CsrView csr;
+    const std::vector<std::vector<int>>* lists;
+};
+
+// The RowCache class keeps computed rows, keyed by vertex, in least
+// recently used order and evicts the oldest ones once the targets they
+// hold exceed the capacity.  The row just inserted is always kept, even
+// if it alone exceeds the capacity.
+class RowCache {
+public:
+    explicit RowCache(std::size_t capacityTargets);
+
+    // Return the cached row of u and mark it as most recently used, or
+    // nullptr if it is not cached.  Counts a hit when found.
+    const std::vector<int>* find(int u);
+
+    // Return true if the row of u is cached, without counting or
+    // reordering anything.
+    bool contains(int u) const { return index.count(u) != 0; }
+
+    // Store row as the row of u, which must not be cached, evict the
+    // oldest rows beyond the capacity and return the stored row.
+    // Counts a miss: every inserted row is one that had to be computed.
+    const std::vector<int>& insert(int u, std::vector<int> row);
+
+    // Drop every row; the hit, miss and eviction counters are kept.
+    void clear();
+
+    const ViewCacheStats& stats() const { return counters; }
+
+private:
+    struct Entry {
+        int vertex;
+        std::vector<int> row;
+    };
+
+    std::size_t capacity;
+    std::list<Entry> entries; // most recently used first
+    std::unordered_map<int, std::list<Entry>::iterator> index;
+    ViewCacheStats counters;
+};
+
+// For all three views: the range returned by neighbours() points into
+// the cache and stays valid until the next call to neighbours(),
+// degree() or prefetch() on the same view.
+
+// The transpose of the base graph: the neighbours of v are the u with
+// an edge (u, v), in ascending order of u with one entry per parallel
+// edge, as in Graph::getTranspose.  A CSR graph stores only out‑edges,
+// so a missing row takes one pass over all edges of the base;
+// prefetch() fills the rows of many vertices in a single pass.
+class TransposeView {
+public:
+    explicit TransposeView(const ViewBase& base,
+                           std::size_t cacheTargets = kDefaultViewCacheTargets);
+
+    int size() const { return base.size(); }
+    NeighbourRange neighbours(int v);
+    int degree(int v) { return static_cast<int>(neighbours(v).size()); }
+
+    // Compute the rows of all given vertices that are not cached in one
+    // pass over the edges of the base.
+    void prefetch(const std::vector<int>& vertices);
+
+    // Build the whole transpose; equals CsrGraph::getTranspose.  O(V + E),
+    // split across the pool if one is given.
+    CsrGraph materialize(ThreadPool* pool = nullptr) const;
+
+    const ViewCacheStats& cacheStats() const { return cache.stats(); }
+    void clearCache() { cache.clear(); }
+
+private:
+    ViewBase base;
+    RowCache cache;
+};
+
+// The square of the base graph: the neighbours of u are the w != u
+// reachable in one or two steps, in the order of CsrGraph::squareGraph.
+// A missing row costs the out‑degrees of u and of its neighbours, the
+// two‑step neighbourhood it touches; the marks that drop duplicates take
+// V bytes, allocated on the first miss.
+class SquareView {
+public:
+    explicit SquareView(const ViewBase& base,
+                        std::size_t cacheTargets = kDefaultViewCacheTargets);
+
+    int size() const { return base.size(); }
+    NeighbourRange neighbours(int u);
+    int degree(int u) { return static_cast<int>(neighbours(u).size()); }
+
+    // Build the whole square; equals CsrGraph::squareGraph.  Rows are
+    // computed in chunks across the pool if one is given, each thread
+    // with marks of its own.
+    CsrGraph materialize(ThreadPool* pool = nullptr) const;
+
+    const ViewCacheStats& cacheStats() const { return cache.stats(); }
+    void clearCache() { cache.clear(); }
+
+private:
+    ViewBase base;
+    RowCache cache;
+    std::vector<char> marks;
+};
+
+// The simple undirected graph of the base: the neighbours of u are the
+// w != u joined to u by an edge in either direction, once each, in
+// ascending order, as in CsrGraph::toSimpleUndirected.  Like the
+// transpose, a missing row needs the in‑edges of u and so takes one pass
+// over all edges of the base; prefetch() batches misses.
+class UndirectedView {
+public:
+    explicit UndirectedView(const ViewBase& base,
+                            std::size_t cacheTargets = kDefaultViewCacheTargets);
+
+    int size() const { return base.size(); }
+    NeighbourRange neighbours(int u);
+    int degree(int u) { return static_cast<int>(neighbours(u).size()); }
+
+    // Compute the rows of all given vertices that are not cached in one
+    // pass over the edges of the base.
+    void prefetch(const std::vector<int>& vertices);
+
+    // Build the whole simple undirected graph; equals
+    // CsrGraph::toSimpleUndirected.  O(V + E), split across the pool if
+    // one is given.
+    CsrGraph materialize(ThreadPool* pool = nullptr) const;
+
+    const ViewCacheStats& cacheStats() const { return cache.stats(); }
+    void clearCache() { cache.clear(); }
+
+private:
+    ViewBase base;
+    RowCache cache;
+};
+
+#endif // GRAPHVIEWS_H
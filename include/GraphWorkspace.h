@@ -0,0 +1,107 @@
+// GraphWorkspace.h
+// Reusable scratch memory for the graph algorithms.  Passing the same
+// workspace (and the same output objects) to repeated calls lets the
+// algorithms reuse buffers that already have enough capacity, so after
+// the first calls on graphs of a given size no further heap allocations
+// happen.  The workspace counts every time one of the buffers it manages
+// has to grow, which makes that property checkable.
+
+#ifndef GRAPHWORKSPACE_H
+#define GRAPHWORKSPACE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AlignedAllocator.h"
+
+// Counters of a workspace.  allocations is the number of times a buffer
+// had to grow (each growth is one heap allocation), bytesAllocated the
+// total size of those allocations and calls the number of algorithm
+// calls that used the workspace.
+struct WorkspaceStats {
+    std::size_t allocations = 0;
+    std::size_t bytesAllocated = 0;
+    std::size_t calls = 0;
+};
+
+// The GraphWorkspace class owns the scratch buffers used by the
+// workspace overloads of Graph and DenseGraphMatrix (BFS, transpose,
+// square and simplification).  The buffers are public so that every
+// algorithm can pick the ones it needs; their contents are unspecified
+// between calls.  Buffers only grow, through reserve(), which updates
+// the counters.  A workspace must not be used by two calls at the same
+// time.
+class GraphWorkspace {
+public:
+    GraphWorkspace() = default;
+
+    GraphWorkspace(const GraphWorkspace&) = delete;
+    GraphWorkspace& operator=(const GraphWorkspace&) = delete;
+
+    // Return the counters.
+    const WorkspaceStats& stats() const { return counters; }
+
+    // Reset the counters to zero; the buffers are kept.
+    void resetStats() { counters = WorkspaceStats(); }
+
+    // Release all buffers; the counters are kept.
+    void release();
+
+    // Record one algorithm call.
+    void beginCall() { ++counters.calls; }
+
+    // Make sure buf can hold n elements without reallocating.  The
+    // capacity grows at least geometrically, so a sequence of growing
+    // requests costs O(log n) allocations.
+    template <typename T, typename A>
+    void reserve(std::vector<T, A>& buf, std::size_t n) {
+        if (buf.capacity() >= n) return;
+        std::size_t grown = std::max(n, buf.capacity() * 2);
+        buf.reserve(grown);
+        ++counters.allocations;
+        counters.bytesAllocated += grown * sizeof(T);
+    }
+
+    // Append value to buf, counting the allocation if it must grow.
+    template <typename T, typename A>
+    void append(std::vector<T, A>& buf, const T& value) {
+        if (buf.size() == buf.capacity()) reserve(buf, buf.size() + 1);
+        buf.push_back(value);
+    }
+
+    // Start a new visited generation for n vertices and return its
+    // stamp: vertex v counts as visited when stamp[v] equals it, so the
+    // array is cleared only when it grows or the stamp wraps around.
+    std::uint32_t nextStamp(std::size_t n);
+
+    // Visited stamps, see nextStamp().
+    std::vector<std::uint32_t> stamp;
+
+    // Queue of a BFS (consumed through a read index) and the visit order
+    // returned by the BFS overloads.
+    std::vector<int> queue;
+    std::vector<int> order;
+
+    // One row of a result under construction and per‑vertex counters.
+    std::vector<int> row;
+    std::vector<int> counts;
+    std::vector<std::size_t> offsets;
+
+    // Edge keys for sorting, and the scratch buffer and histograms of
+    // the radix sort.
+    std::vector<std::uint64_t> keys;
+    std::vector<std::uint64_t> keyScratch;
+    std::vector<std::size_t> histogram;
+
+    // Aligned byte buffers for the dense matrix kernels.
+    std::vector<std::uint8_t, AlignedAllocator<std::uint8_t, 64>> bytes;
+    std::vector<std::uint8_t, AlignedAllocator<std::uint8_t, 64>> bytes2;
+
+private:
+    std::uint32_t currentStamp = 0;
+    WorkspaceStats counters;
+};
+
+#endif // GRAPHWORKSPACE_H
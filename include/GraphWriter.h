@@ -0,0 +1,107 @@
+// GraphWriter.h
+// Fast output of graphs.  Text is formatted with std::to_chars into a
+// large buffer that goes out with one fwrite (or ostream::write) each
+// time it fills, instead of one operator<< per number and a flush per
+// line.  Graphs can be written as adjacency lists, as an adjacency
+// matrix, or as a text edge list ("u v" per line, the format read by
+// EdgeListReader.h and by the .py/plot_*.py scripts); the binary format
+// is the one of GraphFile.h.  Derived graphs such as G^2 (squareRows in
+// SquareEngine.h) can be written from a RowSource one row at a time,
+// without ever being materialized.
+
+#ifndef GRAPHWRITER_H
+#define GRAPHWRITER_H
+
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include "GraphMatrix.h"
+
+// The OutputBuffer class collects output in a fixed buffer and hands it
+// to a C stream or a C++ stream in large blocks.  The destination is
+// written to only when the buffer is full, on flush() and on
+// destruction, so output written to the same stream by other means in
+// between must be preceded by a flush().
+class OutputBuffer {
+public:
+    // Buffer output for a C stream (written with fwrite) or a C++ stream
+    // (written with ostream::write).
+    explicit OutputBuffer(std::FILE* file, std::size_t capacity = std::size_t(1) << 20);
+    explicit OutputBuffer(std::ostream& stream, std::size_t capacity = std::size_t(1) << 20);
+
+    // Flush the remaining output.
+    ~OutputBuffer();
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    // Append one character, a string or raw bytes.
+    void put(char c) {
+        if (used == buffer.size()) drain();
+        buffer[used++] = c;
+    }
+    void put(const char* text);
+    void put(const std::string& text) { putBytes(text.data(), text.size()); }
+    void putBytes(const void* data, std::size_t size);
+
+    // Append the decimal form of value.
+    void putInt(long long value);
+
+    // Write the buffered output to the destination and flush it.
+    // Returns false if any write so far has failed.
+    bool flush();
+
+    // Return false if a write to the destination has failed.
+    bool ok() const;
+
+private:
+    // Write the buffered bytes to the destination and empty the buffer.
+    void drain();
+
+    std::FILE* file;
+    std::ostream* stream;
+    std::vector<char> buffer;
+    std::size_t used;
+    bool failed;
+};
+
+// Adjacency lists as text, one line per vertex: "u: a, b, c", with the
+// neighbours joined by separator.
+void writeAdjacencyList(OutputBuffer& out, const Graph& g, const char* separator = ", ");
+void writeAdjacencyList(OutputBuffer& out, const CsrView& g, const char* separator = ", ");
+void writeAdjacencyList(OutputBuffer& out, int numVertices, const RowSource& rows,
+                        const char* separator = ", ");
+
+// The adjacency matrix as text, one line per row, every cell followed
+// by a space.  Cells 0 .. 9 take a single character store each.
+template <typename Cell>
+void writeAdjacencyMatrix(OutputBuffer& out, const DenseGraphMatrix<Cell>& g);
+
+// A text edge list: a "# vertices n" comment line (so isolated vertices
+// are not lost), then one "u v" line per edge in row order.
+void writeEdgeList(OutputBuffer& out, const Graph& g);
+void writeEdgeList(OutputBuffer& out, const CsrView& g);
+void writeEdgeList(OutputBuffer& out, int numVertices, const RowSource& rows);
+
+// Open path for writing and write a text edge list to it.  Returns
+// false and fills *error (if given) if the file cannot be written.
+bool writeEdgeListFile(const std::string& path, const Graph& g, std::string* error = nullptr);
+bool writeEdgeListFile(const std::string& path, int numVertices, const RowSource& rows,
+                       std::string* error = nullptr);
+
+// Write g, its transpose and its square into the existing directory dir
+// as text edge lists graph.txt, transpose.txt and square.txt (read by
+// the .py/plot_*.py scripts) and as binary graph files graph.bin and
+// square.bin (GraphFile.h), as the --dump option of lab11 and
+// lab11_random does.  The square is streamed row by row from the CSR
+// form of g and never stored.  Stops at the first file that cannot be
+// written and returns false with *error (if given) filled.
+bool writeGraphDump(const std::string& dir, const Graph& g, std::string* error = nullptr);
+
+#endif // GRAPHWRITER_H
@@ -0,0 +1,96 @@
+// MatrixKernels.h
+// Cache‑friendly kernels for dense n x n matrices stored row‑major in
+// one contiguous buffer.  Row i starts at element i * stride, which lets
+// rows be padded for alignment.
+
+#ifndef MATRIXKERNELS_H
+#define MATRIXKERNELS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include "ThreadPool.h"
+
+// Edge length of the square tiles used by the transpose kernels.  A
+// 64 x 64 tile of 4‑byte cells is 16 KiB, so a source and a destination
+// tile fit in L1 together with room to spare in L2 for larger cells.
+const std::size_t kTransposeTile = 64;
+
+// Transpose the tile with rows [i0, i1) and columns [j0, j1) of src
+// into dst.  Reads walk rows of src; the writes go to at most
+// kTransposeTile rows of dst, all of which stay in cache.
+template <typename T>
+void transposeTile(const T* src, std::size_t srcStride, T* dst, std::size_t dstStride,
+                   std::size_t i0, std::size_t i1, std::size_t j0, std::size_t j1) {
+    for (std::size_t i = i0; i < i1; ++i) {
+        const T* row = src + i * srcStride;
+        for (std::size_t j = j0; j < j1; ++j) {
+            dst[j * dstStride + i] = row[j];
+        }
+    }
+}
+
+// Write the transpose of the n x n matrix src into dst (the buffers must
+// not overlap).  The matrix is processed tile by tile instead of row by
+// row, so every cache line of dst is filled completely while it is in
+// cache.  If pool is given, bands of tile rows are handed out to its
+// threads.
+template <typename T>
+void transposeBlocked(const T* src, std::size_t srcStride, T* dst, std::size_t dstStride,
+                      std::size_t n, ThreadPool* pool = nullptr) {
+    std::size_t tiles = (n + kTransposeTile - 1) / kTransposeTile;
+    auto band = [&](std::size_t ti) {
+        std::size_t i0 = ti * kTransposeTile;
+        std::size_t i1 = std::min(n, i0 + kTransposeTile);
+        for (std::size_t j0 = 0; j0 < n; j0 += kTransposeTile) {
+            transposeTile(src, srcStride, dst, dstStride, i0, i1, j0,
+                          std::min(n, j0 + kTransposeTile));
+        }
+    };
+    if (pool) {
+        pool->parallelFor(tiles, 1, [&](int, std::size_t begin, std::size_t end) {
+            for (std::size_t ti = begin; ti < end; ++ti) band(ti);
+        });
+    } else {
+        for (std::size_t ti = 0; ti < tiles; ++ti) band(ti);
+    }
+}
+
+// Transpose the n x n matrix a in place.  Tiles (bi, bj) and (bj, bi)
+// above and below the diagonal are swapped while being transposed, and
+// diagonal tiles are transposed within themselves.  If pool is given,
+// tile rows are handed out to its threads; every pair of tiles belongs
+// to exactly one tile row, so no two threads touch the same cells.
+template <typename T>
+void transposeInPlace(T* a, std::size_t stride, std::size_t n, ThreadPool* pool = nullptr) {
+    std::size_t tiles = (n + kTransposeTile - 1) / kTransposeTile;
+    auto band = [&](std::size_t bi) {
+        std::size_t i0 = bi * kTransposeTile;
+        std::size_t i1 = std::min(n, i0 + kTransposeTile);
+        // Diagonal tile: swap the cells above its diagonal with those below.
+        for (std::size_t i = i0; i < i1; ++i) {
+            for (std::size_t j = i + 1; j < i1; ++j) {
+                std::swap(a[i * stride + j], a[j * stride + i]);
+            }
+        }
+        // Off‑diagonal tiles to the right, each swapped with its mirror.
+        for (std::size_t j0 = i1; j0 < n; j0 += kTransposeTile) {
+            std::size_t j1 = std::min(n, j0 + kTransposeTile);
+            for (std::size_t i = i0; i < i1; ++i) {
+                for (std::size_t j = j0; j < j1; ++j) {
+                    std::swap(a[i * stride + j], a[j * stride + i]);
+                }
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(tiles, 1, [&](int, std::size_t begin, std::size_t end) {
+            for (std::size_t bi = begin; bi < end; ++bi) band(bi);
+        });
+    } else {
+        for (std::size_t bi = 0; bi < tiles; ++bi) band(bi);
+    }
+}
+
+#endif // MATRIXKERNELS_H
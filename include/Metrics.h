@@ -0,0 +1,133 @@
+// Metrics.h
+// Opt‑in instrumentation of the graph algorithms.  When the project is
+// configured with -DLAB11_METRICS=ON, every public algorithm opens a
+// MetricsScope that records its wall time, the edges it scanned, the
+// frontier size of every BFS level, the bytes it allocated and,
+// optionally, hardware counters read through perf_event_open.  The
+// totals per algorithm are kept in a global registry and can be exported
+// as JSON or in the Prometheus text format.
+//
+// Without LAB11_METRICS the LAB11_METRICS_* macros expand to nothing, so
+// the algorithms compile exactly as before.  With it, recording is still
+// switched off at run time until Metrics::setEnabled(true) is called;
+// a disabled scope costs one flag test at entry and exit.
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Hardware counters of one algorithm, summed over its calls.  valid is
+// false if the counters were not requested or perf_event_open failed
+// (not Linux, or forbidden by perf_event_paranoid).
+struct HardwareCounters {
+    bool valid = false;
+    std::uint64_t cycles = 0;
+    std::uint64_t instructions = 0;
+    std::uint64_t cacheMisses = 0;
+    std::uint64_t branchMisses = 0;
+};
+
+// Totals of one algorithm.  edgesScanned counts adjacency entries
+// examined: list entries for the list and CSR forms, matrix cells (n per
+// scanned row) for the matrix forms.  lastFrontier holds the frontier
+// size of every level of the most recent call that reported any.
+struct AlgorithmMetrics {
+    std::string name;
+    std::uint64_t calls = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+    std::uint64_t edgesScanned = 0;
+    std::uint64_t bytesAllocated = 0;
+    std::uint64_t levels = 0;
+    std::vector<std::uint64_t> lastFrontier;
+    HardwareCounters hardware;
+};
+
+// Global registry of the metrics.  All functions are thread‑safe.
+class Metrics {
+public:
+    // Switch recording on or off (off at start).
+    static void setEnabled(bool on);
+    static bool enabled();
+
+    // Also read hardware counters in every scope (off at start).  Each
+    // scope then opens and closes a perf counter group, which costs a
+    // few system calls.
+    static void setHardwareCounters(bool on);
+
+    // Drop all recorded totals.
+    static void reset();
+
+    // Return a copy of the totals, sorted by algorithm name.
+    static std::vector<AlgorithmMetrics> snapshot();
+
+    // Export the totals as a JSON document or in the Prometheus text
+    // exposition format (metric family lab11_algorithm_*, one series per
+    // algorithm).
+    static std::string toJson();
+    static std::string toPrometheus();
+
+    // Bytes allocated with operator new by the calling thread since it
+    // started.  Always 0 without LAB11_METRICS, where operator new is not
+    // replaced.
+    static std::uint64_t threadAllocatedBytes();
+};
+
+// Records one call of an algorithm from construction to destruction and
+// adds it to the registry.  Edge counts and frontier sizes are collected
+// locally and published once at the end.  Allocations are counted for
+// the constructing thread only, so work done by pool threads is not
+// included in bytesAllocated.
+class MetricsScope {
+public:
+    explicit MetricsScope(const char* name);
+    ~MetricsScope();
+
+    MetricsScope(const MetricsScope&) = delete;
+    MetricsScope& operator=(const MetricsScope&) = delete;
+
+    void addEdges(std::uint64_t count) { edges += count; }
+    void addFrontier(std::uint64_t size) {
+        if (active) frontier.push_back(size);
+    }
+
+    // For a queue‑based BFS: the vertex at queue position head is being
+    // expanded and queued vertices have been enqueued so far.  When head
+    // reaches the end of the previous level, the vertices queued since
+    // form the next frontier.
+    void visitQueued(std::uint64_t head, std::uint64_t queued) {
+        if (active && head == levelEnd) {
+            frontier.push_back(queued - head);
+            levelEnd = queued;
+        }
+    }
+
+private:
+    const char* name;
+    bool active;
+    std::uint64_t edges;
+    std::uint64_t startBytes;
+    std::uint64_t startNs;
+    int perfFds[4];
+    std::uint64_t levelEnd;
+    std::vector<std::uint64_t> frontier;
+};
+
+#ifdef LAB11_METRICS
+#define LAB11_METRICS_SCOPE(var, name) MetricsScope var(name)
+#define LAB11_METRICS_EDGES(var, count) (var).addEdges(static_cast<std::uint64_t>(count))
+#define LAB11_METRICS_FRONTIER(var, size) (var).addFrontier(static_cast<std::uint64_t>(size))
+#define LAB11_METRICS_QUEUE(var, head, queued)                                                  \
+    (var).visitQueued(static_cast<std::uint64_t>(head), static_cast<std::uint64_t>(queued))
+#else
+#define LAB11_METRICS_SCOPE(var, name) ((void)0)
+#define LAB11_METRICS_EDGES(var, count) ((void)0)
+#define LAB11_METRICS_FRONTIER(var, size) ((void)0)
+#define LAB11_METRICS_QUEUE(var, head, queued) ((void)0)
+#endif
+
+#endif // METRICS_H
@@ -0,0 +1,25 @@
+// PowerReport.h
+// Progress and memory reporting for the long‑running graph power and
+// transitive closure computations.
+
+#ifndef POWERREPORT_H
+#define POWERREPORT_H
+
+#include <cstddef>
+#include <functional>
+
+// Optional report passed to power() and transitiveClosure().  The caller
+// may set onProgress; the algorithm fills in peakBytes.
+struct PowerReport {
+    // Called from time to time with the number of completed work units
+    // and their total (rows, pivots or squaring steps, depending on the
+    // algorithm).  The last call always has done == total.  May be empty.
+    std::function<void(std::size_t done, std::size_t total)> onProgress;
+
+    // Largest number of bytes held at the same time by intermediate
+    // results, the output and scratch buffers (the input graph is not
+    // counted).
+    std::size_t peakBytes = 0;
+};
+
+#endif // POWERREPORT_H
@@ -0,0 +1,43 @@
+// RadixSort.h
+// Least‑significant‑digit radix sort for 64‑bit keys, used to sort and
+// deduplicate edge keys without hashing.
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ThreadPool;
+
+// Number of buckets per pass (11‑bit digits).
+const std::size_t kRadixBuckets = std::size_t(1) << 11;
+
+// Sort keys in ascending order, looking only at the lowest keyBits bits
+// (higher bits must be zero).  Uses 11‑bit digits, so a key of b bits
+// needs ceil(b / 11) passes over the data; a pass is skipped when all
+// keys share the same digit.  One scratch buffer of the same size as
+// keys is allocated.  If pool is given, every pass counts and scatters
+// in parallel with per‑thread histograms over fixed blocks, so the
+// result is the same for any number of threads.
+void radixSort(std::vector<std::uint64_t>& keys, int keyBits, ThreadPool* pool = nullptr);
+
+// Same as above with caller‑owned scratch memory, for repeated sorts
+// without allocation: scratch is resized to keys.size() and histogram to
+// kRadixBuckets per thread; neither allocates once large enough.  keys
+// and scratch may exchange their buffers.
+void radixSort(std::vector<std::uint64_t>& keys, int keyBits, std::vector<std::uint64_t>& scratch,
+               std::vector<std::size_t>& histogram, ThreadPool* pool = nullptr);
+
+// Sort keys with radixSort and remove duplicates, shrinking the vector.
+void radixSortUnique(std::vector<std::uint64_t>& keys, int keyBits, ThreadPool* pool = nullptr);
+void radixSortUnique(std::vector<std::uint64_t>& keys, int keyBits,
+                     std::vector<std::uint64_t>& scratch, std::vector<std::size_t>& histogram,
+                     ThreadPool* pool = nullptr);
+
+// Return the number of bits needed to store the values 0 .. maxValue
+// (at least 1).
+int bitsFor(std::uint64_t maxValue);
+
+#endif // RADIXSORT_H
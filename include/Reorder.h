@@ -0,0 +1,99 @@
+// Reorder.h
+// Vertex reordering for memory locality.  Computes a permutation of the
+// vertex IDs (degree‑descending, BFS order or Reverse Cuthill–McKee),
+// rebuilds a graph under it and maps results computed on the relabelled
+// graph back to the original IDs.
+
+#ifndef REORDER_H
+#define REORDER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "BfsEngine.h"
+#include "CsrGraph.h"
+#include "Graph.h"
+
+// A bijection between the original vertex IDs and new IDs.  newId[v] is
+// the new ID of original vertex v and oldId[i] the original vertex that
+// got new ID i.
+struct VertexPermutation {
+    std::vector<int> newId;
+    std::vector<int> oldId;
+
+    int size() const { return static_cast<int>(newId.size()); }
+    int toNew(int v) const { return newId[v]; }
+    int toOld(int i) const { return oldId[i]; }
+
+    // Build the permutation that places order[i] at position i.  order
+    // must contain every vertex 0 .. order.size() ‑ 1 exactly once.
+    static VertexPermutation fromOrder(std::vector<int> order);
+};
+
+// Orderings understood by computeOrdering.
+enum class VertexOrdering {
+    Identity,
+    DegreeDescending,
+    Bfs,
+    ReverseCuthillMcKee
+};
+
+// Return a short name for the ordering ("identity", "degree", "bfs",
+// "rcm").
+const char* orderingName(VertexOrdering ordering);
+
+// The identity permutation on n vertices.
+VertexPermutation identityOrder(int n);
+
+// Vertices sorted by total degree (out plus in), largest first; ties
+// keep the original order.  Hubs get the smallest IDs, so their entries
+// in per‑vertex arrays share a few cache lines.  O(V log V + E).
+VertexPermutation degreeOrder(const CsrView& g);
+
+// Vertices in the order Graph::BFS visits them from start (out‑neighbours
+// in list order); vertices it does not reach follow, each unvisited
+// vertex in increasing ID starting another search.  Neighbours of a
+// vertex end up with nearby IDs.  O(V + E).
+VertexPermutation bfsOrder(const CsrView& g, int start = 0);
+
+// Reverse Cuthill–McKee on the undirected version of g (every edge taken
+// in both directions).  Each connected component is searched from a
+// pseudo‑peripheral vertex found by repeated BFS (George and Liu);
+// unvisited neighbours are appended in order of increasing degree, and
+// the final order is reversed.  Keeps edges close to the diagonal of the
+// adjacency matrix, i.e. both ends of an edge have close IDs.
+// O(V + E log maxdeg) per BFS sweep.
+VertexPermutation reverseCuthillMcKee(const CsrView& g);
+
+// Dispatch to one of the functions above.
+VertexPermutation computeOrdering(const CsrView& g, VertexOrdering ordering);
+VertexPermutation computeOrdering(const Graph& g, VertexOrdering ordering);
+
+// Rebuild g with vertex v renamed to p.newId[v]: edge (u, v) becomes
+// (newId[u], newId[v]).  Every neighbour list of the result is sorted by
+// new ID, so scans walk per‑vertex arrays in increasing address order.
+// O(V + E log maxdeg).
+CsrGraph relabel(const CsrView& g, const VertexPermutation& p);
+Graph relabel(const Graph& g, const VertexPermutation& p);
+
+// Map a list of new vertex IDs (for example a BFS visit order) back to
+// original IDs.  Entries of ‑1 are kept.
+std::vector<int> verticesToOriginal(const std::vector<int>& vertices,
+                                    const VertexPermutation& p);
+
+// Reindex an array with one value per vertex from new to original IDs:
+// result[v] = values[newId[v]].
+template <typename T>
+std::vector<T> valuesToOriginal(const std::vector<T>& values, const VertexPermutation& p) {
+    std::vector<T> result(values.size());
+    for (std::size_t v = 0; v < values.size(); ++v) {
+        result[v] = values[static_cast<std::size_t>(p.newId[v])];
+    }
+    return result;
+}
+
+// Map a BFS result on the relabelled graph back to original IDs: the
+// arrays are reindexed and parent entries translated.
+BfsResult toOriginal(const BfsResult& result, const VertexPermutation& p);
+
+#endif // REORDER_H
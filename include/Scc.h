@@ -0,0 +1,80 @@
+// Scc.h
+// Strongly connected components of a directed graph and its
+// condensation.  Three algorithms give the same partition: Kosaraju's
+// two passes over the graph and its transpose, Tarjan's single pass, and
+// a parallel forward‑backward / colouring algorithm for multi‑core
+// machines.  All of them are iterative, so deep graphs (long paths,
+// million‑vertex cycles) cannot overflow the call stack.
+
+#ifndef SCC_H
+#define SCC_H
+
+#include <vector>
+
+#include "CsrGraph.h"
+#include "Graph.h"
+#include "ThreadPool.h"
+
+// Partition of the vertices into strongly connected components.
+// component[v] is the ID of the component of v, in [0, count).
+struct SccResult {
+    int count = 0;
+    std::vector<int> component;
+};
+
+// Kosaraju's algorithm.  gT must be the transpose of g.  A depth‑first
+// search over g records the vertices in order of completion; a second
+// search over gT, started from the unassigned vertex that finished last,
+// collects one component at a time.  Components are numbered in
+// topological order: every edge between two components goes from the
+// smaller ID to the larger.  O(V + E).
+SccResult kosarajuSCC(const CsrView& g, const CsrView& gT);
+
+// Same on an adjacency‑list graph, with its transpose taken by
+// Graph::getTranspose.
+SccResult kosarajuSCC(const Graph& g);
+
+// Tarjan's algorithm with an explicit call stack: one depth‑first search
+// that tracks the lowest index reachable from every vertex and pops a
+// component when a vertex is its own root.  Needs no transpose.  The
+// numbering is the same as kosarajuSCC.  O(V + E).
+SccResult tarjanSCC(const CsrView& g);
+SccResult tarjanSCC(const Graph& g);
+
+// Parallel SCC after Hong, Rodia and Olukotun, "On Fast Parallel
+// Detection of Strongly Connected Components in Small‑World Graphs"
+// (SC 2013).  gT must be the transpose of g.
+//   1. Trim: vertices without an in‑ or out‑edge inside the remaining
+//      graph are components of their own; removing them may expose
+//      more, which are found through atomic degree counters.
+//   2. Forward‑backward: the vertices both reachable from and reaching
+//      a pivot of high degree form its component, which in small‑world
+//      graphs is usually the giant one.  Both searches are
+//      level‑synchronous and parallel.  Then trim again.
+//   3. Colouring (Orzan): every remaining vertex takes the colour of the
+//      highest‑priority vertex that reaches it (priorities are a hash of
+//      the ID), propagated forward in parallel; each vertex that kept its
+//      own colour is a root, and a backward search over the vertices of
+//      its colour yields its component.  The roots are searched in
+//      parallel, then colouring repeats on what is left.
+// Components are numbered in order of their smallest vertex, so the
+// result does not depend on the number of threads.  Small frontiers are
+// expanded on the calling thread.  Long chains of small non‑trivial
+// components are the worst case: colouring then needs one round per
+// component along the chain.
+SccResult parallelSCC(const CsrView& g, const CsrView& gT, ThreadPool& pool);
+
+// Return true if a and b describe the same partition, whatever the IDs.
+bool sameComponents(const SccResult& a, const SccResult& b);
+
+// The condensation of g: one vertex per component and an edge (c, d)
+// whenever some edge of g leads from component c to component d != c.
+// Every neighbour list is sorted and free of duplicates, and the graph
+// is acyclic.  The inter‑component edges are streamed into
+// CsrGraph::fromEdgeChunks one vertex range at a time, so they are
+// never stored as an edge list.  If pool is given, the build runs in
+// parallel.  O(V + E).
+CsrGraph condensation(const CsrView& g, const SccResult& scc, ThreadPool* pool = nullptr);
+Graph condensation(const Graph& g, const SccResult& scc);
+
+#endif // SCC_H
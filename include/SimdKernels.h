@@ -0,0 +1,47 @@
+// SimdKernels.h
+// Byte‑level row kernels for dense adjacency matrices.  Each kernel has
+// a scalar, an SSE2 and an AVX2 version; the fastest one supported by
+// the running CPU is picked once, on first use.  The kernels work on raw
+// bytes, so they apply to matrices of any integer cell type: a cell is
+// non‑zero exactly when one of its bytes is non‑zero, and OR of two
+// cells is the byte‑wise OR.
+
+#ifndef SIMDKERNELS_H
+#define SIMDKERNELS_H
+
+#include <cstddef>
+
+// dst[i] |= src[i] for i in [0, bytes).
+void orBytes(void* dst, const void* src, std::size_t bytes);
+
+// Return the index of the first non‑zero byte of p in [begin, end), or
+// end if there is none.
+std::size_t findNonzeroByte(const void* p, std::size_t begin, std::size_t end);
+
+// Return the index of the first i in [begin, end) for which
+// a[i] & b[i] is non‑zero, or end if there is none.
+std::size_t findNonzeroAndByte(const void* a, const void* b, std::size_t begin, std::size_t end);
+
+// Cell kernels.  They view memory as cells of cellBytes bytes, which
+// must be 1, 2 or 4; a cell is non‑zero if any of its bytes is.
+
+// Return the number of non‑zero cells among the first cells of p.
+std::size_t countNonzeroCells(const void* p, std::size_t cells, std::size_t cellBytes);
+
+// counts[j] += 1 for every non‑zero cell j of row, j in [0, cells).
+// Summed over all rows of a matrix this gives the column counts.
+void addNonzeroCells(int* counts, const void* row, std::size_t cells, std::size_t cellBytes);
+
+// Scan one column: the cell at byteOffset (a multiple of cellBytes) of
+// rows rowBegin .. rowEnd ‑ 1, rows being strideBytes apart from base.
+// Return the first row whose cell is zero, or rowEnd if there is none.
+// The AVX2 version gathers eight rows per step as aligned 4‑byte words,
+// so strideBytes must be a multiple of 4 and below 2^28.
+std::size_t findZeroCellInColumn(const void* base, std::size_t strideBytes,
+                                 std::size_t byteOffset, std::size_t cellBytes,
+                                 std::size_t rowBegin, std::size_t rowEnd);
+
+// Return the name of the kernel set in use: "avx2", "sse2" or "scalar".
+const char* simdLevel();
+
+#endif // SIMDKERNELS_H
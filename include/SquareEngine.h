@@ -0,0 +1,45 @@
+// SquareEngine.h
+// Parallel computation of the square graph G^2 for large sparse graphs
+// in CSR form, plus cheap estimates of the output size.
+
+#ifndef SQUAREENGINE_H
+#define SQUAREENGINE_H
+
+#include <cstdint>
+
+#include "CsrGraph.h"
+#include "ThreadPool.h"
+
+// Return an upper bound on the number of edges of G^2 without computing
+// it: the sum over u of deg(u) plus the degrees of all out‑neighbours of
+// u, i.e. the number of paths of length one or two.  O(V + E).
+std::uint64_t estimateSquareEdges(const CsrView& g);
+
+// Return the exact number of edges of G^2 (the symbolic pass of
+// parallelSquareGraph on its own).
+std::uint64_t countSquareEdges(const CsrView& g, ThreadPool& pool);
+
+// Compute the square of g: an edge (u, w) for every path of length one
+// or two from u to w, without loops.  The result equals
+// CsrGraph::squareGraph, including the order of every neighbour list.
+//
+// Runs in two passes over the rows, both split across the pool.  The
+// symbolic pass counts the distinct targets of every row, a prefix sum
+// turns the counts into offsets so that the output is allocated exactly
+// once, and the numeric pass writes each row into its slot.  Each thread
+// uses a bit‑set sparse accumulator whose marks are cleared through the
+// list of touched vertices, so no pass costs O(V) per row.
+CsrGraph parallelSquareGraph(const CsrView& g, ThreadPool& pool);
+
+// Same as above with a temporary pool of numThreads threads (zero or
+// less selects ThreadPool::defaultThreadCount()).
+CsrGraph parallelSquareGraph(const CsrView& g, int numThreads = 0);
+
+// Return a RowSource for the square of g: row u holds the same targets
+// in the same order as row u of CsrGraph::squareGraph, computed when it
+// is asked for, so G^2 can be written out without being stored.  Uses
+// V bytes of marks, cleared through the row after every call.  g must
+// outlive the source.
+RowSource squareRows(const CsrView& g);
+
+#endif // SQUAREENGINE_H
@@ -0,0 +1,76 @@
+// ThreadPool.h
+// A small fixed‑size pool of worker threads used by the parallel graph
+// algorithms.  Work is submitted as one task per thread or as a parallel
+// loop over an index range; both calls block until all work is done.
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The ThreadPool class keeps (numThreads ‑ 1) worker threads alive for
+// its whole lifetime; the thread calling run() or parallelFor() takes
+// part in the work as thread 0.  Thread indices passed to tasks are
+// stable within one call, so callers can keep per‑thread buffers indexed
+// by them.  A pool must not be used from several threads at once.
+class ThreadPool {
+public:
+    // Create a pool with the given number of threads.  A value of zero
+    // or less selects defaultThreadCount().
+    explicit ThreadPool(int numThreads = 0);
+
+    // Stop and join all worker threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Return the number of threads, including the calling thread.
+    int size() const;
+
+    // Run task(threadIndex) once on every thread and wait for all of them.
+    void run(const std::function<void(int)>& task);
+
+    // Split [0, count) into chunks of at most grain indices and hand them
+    // out dynamically.  body(threadIndex, begin, end) is called once per
+    // chunk.  Waits until the whole range is processed.
+    void parallelFor(std::size_t count, std::size_t grain,
+                     const std::function<void(int, std::size_t, std::size_t)>& body);
+
+    // Return the number of hardware threads, or 1 if it is unknown.
+    static int defaultThreadCount();
+
+private:
+    void workerLoop(int index);
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(int)>* task;
+    std::size_t generation;
+    int pending;
+    bool stopping;
+};
+
+// Helpers for algorithms whose pool is optional: without a pool the
+// work runs on the calling thread as thread 0.
+
+// Return the number of threads of pool, or 1 without a pool.
+int threadCount(const ThreadPool* pool);
+
+// Run task(threadIndex) once on every thread of pool, or task(0) once.
+void runOnThreads(ThreadPool* pool, const std::function<void(int)>& task);
+
+// Run body over [0, count) in dynamic chunks of grain as
+// ThreadPool::parallelFor does, or as body(0, 0, count) in one call
+// (not at all if count is 0).
+void parallelFor(ThreadPool* pool, std::size_t count, std::size_t grain,
+                 const std::function<void(int, std::size_t, std::size_t)>& body);
+
+#endif // THREADPOOL_H
@@ -0,0 +1,368 @@
+// BfsEngine.cpp
+// Implementation of the BFS engines declared in BfsEngine.h
+
+#include "../include/BfsEngine.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Return a result for n vertices with every entry set to ‑1.
+static BfsResult emptyResult(int n) {
+    BfsResult result;
+    result.distance.assign(n, -1);
+    result.parent.assign(n, -1);
+    return result;
+}
+
+// Sum of the out‑degrees of the reached vertices: the edges a BFS that
+// expands every reached vertex once has scanned.
+[[maybe_unused]] static std::uint64_t expandedEdges(const CsrView& g, const BfsResult& result) {
+    std::uint64_t edges = 0;
+    for (int v = 0; v < g.size(); ++v) {
+        if (result.distance[v] != -1) edges += g.degree(v);
+    }
+    return edges;
+}
+
+// Top‑down BFS: the distance array doubles as the visited marker and the
+// queue is a plain vector consumed through a read index.
+BfsResult topDownBFS(const CsrView& g, int start) {
+    LAB11_METRICS_SCOPE(metrics, "topDownBFS");
+    int n = g.size();
+    BfsResult result = emptyResult(n);
+    if (start < 0 || start >= n) return result;
+    std::vector<int> queue;
+    queue.reserve(n);
+    result.distance[start] = 0;
+    queue.push_back(start);
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        int u = queue[head];
+        LAB11_METRICS_QUEUE(metrics, head, queue.size());
+        LAB11_METRICS_EDGES(metrics, g.degree(u));
+        for (int v : g.neighbours(u)) {
+            if (result.distance[v] == -1) {
+                result.distance[v] = result.distance[u] + 1;
+                result.parent[v] = u;
+                queue.push_back(v);
+            }
+        }
+    }
+    return result;
+}
+
+// Direction‑optimizing BFS.  The frontier is kept in two forms: a list of
+// vertices for top‑down steps and a bit set for bottom‑up steps; it is
+// converted only when the direction changes.
+//
+// Top‑down step: every frontier vertex claims its unvisited
+// out‑neighbours.  Bottom‑up step: every unvisited vertex looks for any
+// in‑neighbour in the frontier and stops at the first hit, which skips
+// most edge checks when the frontier is a large part of the graph.
+BfsResult directionOptimizingBFS(const CsrView& g, const CsrView& gT, int start,
+                                 const BfsOptions& options) {
+    LAB11_METRICS_SCOPE(metrics, "directionOptimizingBFS");
+    int n = g.size();
+    BfsResult result = emptyResult(n);
+    if (start < 0 || start >= n || gT.size() != n) return result;
+    // Both thresholds are divisors, so values below 1 are clamped.
+    const std::uint64_t alpha = static_cast<std::uint64_t>(std::max(1, options.alpha));
+    const int beta = std::max(1, options.beta);
+
+    std::vector<int> frontier;
+    std::vector<int> next;
+    std::vector<std::uint64_t> frontierBits((n + 63) / 64, 0);
+    std::vector<std::uint64_t> nextBits((n + 63) / 64, 0);
+    frontier.reserve(n);
+    next.reserve(n);
+
+    result.distance[start] = 0;
+    frontier.push_back(start);
+    // Edges that still leave unvisited vertices (m_u in the paper) and
+    // edges leaving the current frontier (m_f).
+    std::uint64_t edgesUnexplored = g.numEdges() - g.degree(start);
+    std::uint64_t edgesFrontier = g.degree(start);
+    bool bottomUp = false;
+    std::size_t frontierSize = 1;
+    int level = 0;
+
+    while (frontierSize > 0) {
+        LAB11_METRICS_FRONTIER(metrics, frontierSize);
+        if (!bottomUp && edgesFrontier > edgesUnexplored / alpha) {
+            // Switch to bottom‑up: turn the frontier list into a bit set.
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (int u : frontier) {
+                frontierBits[u / 64] |= std::uint64_t(1) << (u % 64);
+            }
+            bottomUp = true;
+        } else if (bottomUp && frontierSize < static_cast<std::size_t>(n / beta)) {
+            // Switch back to top‑down: turn the bit set into a list.
+            frontier.clear();
+            for (int u = 0; u < n; ++u) {
+                if ((frontierBits[u / 64] >> (u % 64)) & 1) frontier.push_back(u);
+            }
+            bottomUp = false;
+        }
+
+        std::size_t nextSize = 0;
+        std::uint64_t nextEdges = 0;
+        if (bottomUp) {
+            std::fill(nextBits.begin(), nextBits.end(), 0);
+            for (int v = 0; v < n; ++v) {
+                if (result.distance[v] != -1) continue;
+                for (int u : gT.neighbours(v)) {
+                    LAB11_METRICS_EDGES(metrics, 1);
+                    if ((frontierBits[u / 64] >> (u % 64)) & 1) {
+                        result.distance[v] = level + 1;
+                        result.parent[v] = u;
+                        nextBits[v / 64] |= std::uint64_t(1) << (v % 64);
+                        ++nextSize;
+                        nextEdges += g.degree(v);
+                        break;
+                    }
+                }
+            }
+            frontierBits.swap(nextBits);
+        } else {
+            next.clear();
+            for (int u : frontier) {
+                LAB11_METRICS_EDGES(metrics, g.degree(u));
+                for (int v : g.neighbours(u)) {
+                    if (result.distance[v] == -1) {
+                        result.distance[v] = level + 1;
+                        result.parent[v] = u;
+                        next.push_back(v);
+                        nextEdges += g.degree(v);
+                    }
+                }
+            }
+            nextSize = next.size();
+            frontier.swap(next);
+        }
+        edgesUnexplored -= nextEdges;
+        edgesFrontier = nextEdges;
+        frontierSize = nextSize;
+        ++level;
+    }
+    return result;
+}
+
+// Convert g and its transpose to CSR form and run the engine.
+BfsResult directionOptimizingBFS(const Graph& g, int start, const BfsOptions& options) {
+    CsrGraph csr = CsrGraph::fromGraph(g);
+    CsrGraph csrT = CsrGraph::fromGraph(g.getTranspose());
+    return directionOptimizingBFS(csr, csrT, start, options);
+}
+
+// Parallel level‑synchronous BFS.  Per level: (1) threads take chunks of
+// the frontier and claim unvisited out‑neighbours with fetch_or on the
+// visited bit map, appending claimed vertices to their local list;
+// (2) a prefix sum over the local list sizes gives every thread its slot
+// in the next frontier; (3) threads copy their lists into place.
+BfsResult parallelBFS(const CsrView& g, int start, ThreadPool& pool) {
+    LAB11_METRICS_SCOPE(metrics, "parallelBFS");
+    int n = g.size();
+    BfsResult result = emptyResult(n);
+    if (start < 0 || start >= n) return result;
+
+    std::size_t numWords = (static_cast<std::size_t>(n) + 63) / 64;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> visited(
+        new std::atomic<std::uint64_t>[numWords]);
+    for (std::size_t w = 0; w < numWords; ++w) {
+        visited[w].store(0, std::memory_order_relaxed);
+    }
+    int threads = pool.size();
+    std::vector<std::vector<int>> local(threads);
+    std::vector<std::size_t> slot(threads + 1, 0);
+    std::vector<int> frontier;
+    std::vector<int> next;
+    frontier.reserve(n);
+    next.reserve(n);
+
+    visited[start / 64].store(std::uint64_t(1) << (start % 64), std::memory_order_relaxed);
+    result.distance[start] = 0;
+    frontier.push_back(start);
+    int level = 0;
+
+    while (!frontier.empty()) {
+        LAB11_METRICS_FRONTIER(metrics, frontier.size());
+        for (auto& list : local) list.clear();
+        pool.parallelFor(frontier.size(), 256, [&](int t, std::size_t begin, std::size_t end) {
+            std::vector<int>& out = local[t];
+            for (std::size_t i = begin; i < end; ++i) {
+                int u = frontier[i];
+                for (int v : g.neighbours(u)) {
+                    std::atomic<std::uint64_t>& word = visited[v / 64];
+                    std::uint64_t mask = std::uint64_t(1) << (v % 64);
+                    // Cheap test first; only try to claim if still unvisited.
+                    if (word.load(std::memory_order_relaxed) & mask) continue;
+                    if (word.fetch_or(mask, std::memory_order_relaxed) & mask) continue;
+                    result.distance[v] = level + 1;
+                    result.parent[v] = u;
+                    out.push_back(v);
+                }
+            }
+        });
+        for (int t = 0; t < threads; ++t) {
+            slot[t + 1] = slot[t] + local[t].size();
+        }
+        next.resize(slot[threads]);
+        pool.run([&](int t) {
+            std::copy(local[t].begin(), local[t].end(), next.begin() + slot[t]);
+        });
+        frontier.swap(next);
+        ++level;
+    }
+    // The workers do not count; every reached vertex was expanded once.
+    LAB11_METRICS_EDGES(metrics, expandedEdges(g, result));
+    return result;
+}
+
+// Run the parallel BFS on a temporary pool.
+BfsResult parallelBFS(const CsrView& g, int start, int numThreads) {
+    ThreadPool pool(numThreads);
+    return parallelBFS(g, start, pool);
+}
+
+// Scratch masks of one MS‑BFS batch, reused by a thread for all of its
+// batches.  Vertex v owns words [v * W, v * W + W) of every array.
+struct MultiBfsBuffers {
+    std::vector<std::uint64_t> seen;
+    std::vector<std::uint64_t> visit;
+    std::vector<std::uint64_t> next;
+};
+
+// Run one batch of at most 64 * W sources and call found(i, v, level)
+// whenever v is reached from sources[i] at the given distance.  Per
+// level, every vertex with a non‑empty frontier mask pushes the mask to
+// its out‑neighbours, minus the sources that have already seen them;
+// then the new masks are cleaned of sources that were seen before and
+// the bits that remain are reported.  W is a compile‑time constant, so
+// the word loops are unrolled and vectorised.
+template <int W, typename Found>
+static void runBatch(const CsrView& g, const int* sources, std::size_t count,
+                     MultiBfsBuffers& buf, Found found) {
+    std::size_t n = static_cast<std::size_t>(g.size());
+    buf.seen.assign(n * W, 0);
+    buf.visit.assign(n * W, 0);
+    buf.next.assign(n * W, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        int s = sources[i];
+        if (s < 0 || static_cast<std::size_t>(s) >= n) continue;
+        std::uint64_t bit = std::uint64_t(1) << (i % 64);
+        buf.seen[s * W + i / 64] |= bit;
+        buf.visit[s * W + i / 64] |= bit;
+        found(i, s, 0);
+    }
+    for (int level = 1;; ++level) {
+        const std::uint64_t* seen = buf.seen.data();
+        const std::uint64_t* visit = buf.visit.data();
+        std::uint64_t* next = buf.next.data();
+        for (std::size_t v = 0; v < n; ++v) {
+            const std::uint64_t* fv = visit + v * W;
+            std::uint64_t any = 0;
+            for (int k = 0; k < W; ++k) any |= fv[k];
+            if (any == 0) continue;
+            for (int w : g.neighbours(static_cast<int>(v))) {
+                std::uint64_t* nw = next + static_cast<std::size_t>(w) * W;
+                const std::uint64_t* sw = seen + static_cast<std::size_t>(w) * W;
+                for (int k = 0; k < W; ++k) nw[k] |= fv[k] & ~sw[k];
+            }
+        }
+        bool progress = false;
+        std::uint64_t* seenOut = buf.seen.data();
+        for (std::size_t v = 0; v < n; ++v) {
+            std::uint64_t* nv = next + v * W;
+            std::uint64_t* sv = seenOut + v * W;
+            std::uint64_t any = 0;
+            for (int k = 0; k < W; ++k) {
+                nv[k] &= ~sv[k];
+                sv[k] |= nv[k];
+                any |= nv[k];
+            }
+            if (any == 0) continue;
+            progress = true;
+            for (int k = 0; k < W; ++k) {
+                for (std::uint64_t b = nv[k]; b != 0; b &= b - 1) {
+                    found(static_cast<std::size_t>(k) * 64 + __builtin_ctzll(b),
+                          static_cast<int>(v), level);
+                }
+            }
+        }
+        if (!progress) break;
+        buf.visit.swap(buf.next);
+        std::fill(buf.next.begin(), buf.next.end(), 0);
+    }
+}
+
+// Split the sources into batches and run them, serially or one batch
+// per task on the pool.  found(i, v, level) receives the index of the
+// source in the whole input.
+template <typename Found>
+static void forEachBatch(const CsrView& g, const int* sources, std::size_t count,
+                         ThreadPool* pool, Found found) {
+    if (count == 0) return;
+    const bool wide = count > 64;
+    const std::size_t batch = wide ? 256 : 64;
+    const std::size_t batches = (count + batch - 1) / batch;
+    std::vector<MultiBfsBuffers> buffers(pool ? pool->size() : 1);
+    auto runOne = [&](int t, std::size_t b) {
+        std::size_t base = b * batch;
+        std::size_t size = std::min(batch, count - base);
+        auto report = [&](std::size_t i, int v, int level) { found(base + i, v, level); };
+        if (wide) {
+            runBatch<4>(g, sources + base, size, buffers[t], report);
+        } else {
+            runBatch<1>(g, sources + base, size, buffers[t], report);
+        }
+    };
+    if (pool && batches > 1) {
+        pool->parallelFor(batches, 1, [&](int t, std::size_t begin, std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b) runOne(t, b);
+        });
+    } else {
+        for (std::size_t b = 0; b < batches; ++b) runOne(0, b);
+    }
+}
+
+// Fill the distance table row by row; each batch writes only its rows.
+MultiBfsResult multiSourceBFS(const CsrView& g, const int* sources, std::size_t count,
+                              ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "multiSourceBFS");
+    MultiBfsResult result;
+    result.numVertices = g.size();
+    result.sources.assign(sources, sources + count);
+    std::size_t n = static_cast<std::size_t>(g.size());
+    result.distance.assign(count * n, -1);
+    int* table = result.distance.data();
+    forEachBatch(g, sources, count, pool, [&](std::size_t i, int v, int level) {
+        table[i * n + static_cast<std::size_t>(v)] = level;
+    });
+    return result;
+}
+
+MultiBfsResult multiSourceBFS(const CsrView& g, const std::vector<int>& sources,
+                              ThreadPool* pool) {
+    return multiSourceBFS(g, sources.data(), sources.size(), pool);
+}
+
+// Accumulate the reach of every source; each batch writes only its entries.
+std::vector<SourceReach> multiSourceReach(const CsrView& g, const int* sources,
+                                          std::size_t count, ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "multiSourceReach");
+    std::vector<SourceReach> reach(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        reach[i].source = sources[i];
+    }
+    forEachBatch(g, sources, count, pool, [&](std::size_t i, int, int level) {
+        ++reach[i].reached;
+        reach[i].distanceSum += level;
+    });
+    return reach;
+}
+
+std::vector<SourceReach> multiSourceReach(const CsrView& g, const std::vector<int>& sources,
+                                          ThreadPool* pool) {
+    return multiSourceReach(g, sources.data(), sources.size(), pool);
+}
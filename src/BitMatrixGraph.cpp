@@ -0,0 +1,319 @@
+// BitMatrixGraph.cpp
+// Implementation of BitMatrixGraph declared in BitMatrixGraph.h
+
+#include "../include/BitMatrixGraph.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+
+// Index of the lowest set bit of a non‑zero word.
+static inline int lowestBit(std::uint64_t w) {
+    return __builtin_ctzll(w);
+}
+
+// Transpose a 64 x 64 bit block in place: afterwards bit i of a[j] is
+// what bit j of a[i] was.  Each round swaps the off‑diagonal quarters
+// of every 2j x 2j sub‑block, halving j until single bits are swapped.
+static void transpose64(std::uint64_t a[64]) {
+    std::uint64_t m = 0x00000000FFFFFFFFULL;
+    for (int j = 32; j != 0; j >>= 1, m ^= (m << j)) {
+        for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            std::uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k] ^= t << j;
+            a[k | j] ^= t;
+        }
+    }
+}
+
+// Construct an empty bit matrix graph with n vertices.
+BitMatrixGraph::BitMatrixGraph(int n)
+    : n(n < 0 ? 0 : n),
+      words((static_cast<std::size_t>(this->n) + 63) / 64),
+      bits(static_cast<std::size_t>(this->n) * words, 0) {}
+
+// Convert an int matrix graph.
+BitMatrixGraph BitMatrixGraph::fromMatrix(const GraphMatrix& gm) {
+    BitMatrixGraph g(gm.size());
+    const auto& mat = gm.getMatrix();
+    for (int i = 0; i < g.n; ++i) {
+        std::uint64_t* r = g.rowData(i);
+        for (int j = 0; j < g.n; ++j) {
+            if (mat[i][j] != 0) {
+                r[j / 64] |= std::uint64_t(1) << (j % 64);
+            }
+        }
+    }
+    return g;
+}
+
+// Convert back into an int matrix graph.
+GraphMatrix BitMatrixGraph::toMatrix() const {
+    GraphMatrix gm(n);
+    for (int i = 0; i < n; ++i) {
+        const std::uint64_t* r = row(i);
+        for (std::size_t w = 0; w < words; ++w) {
+            for (std::uint64_t b = r[w]; b != 0; b &= b - 1) {
+                gm.setEdge(i, static_cast<int>(w * 64) + lowestBit(b), 1);
+            }
+        }
+    }
+    return gm;
+}
+
+// Set or clear the edge from u to v.
+void BitMatrixGraph::setEdge(int u, int v, bool present) {
+    if (u < 0 || u >= n || v < 0 || v >= n) return;
+    std::uint64_t mask = std::uint64_t(1) << (v % 64);
+    if (present) {
+        rowData(u)[v / 64] |= mask;
+    } else {
+        rowData(u)[v / 64] &= ~mask;
+    }
+}
+
+// Test the edge from u to v.
+bool BitMatrixGraph::hasEdge(int u, int v) const {
+    return (row(u)[v / 64] >> (v % 64)) & 1;
+}
+
+// Return the number of vertices.
+int BitMatrixGraph::size() const {
+    return n;
+}
+
+// Return the number of words per row.
+std::size_t BitMatrixGraph::wordsPerRow() const {
+    return words;
+}
+
+// Return a pointer to the first word of row u.
+const std::uint64_t* BitMatrixGraph::row(int u) const {
+    return bits.data() + static_cast<std::size_t>(u) * words;
+}
+
+// Mutable access to row u.
+std::uint64_t* BitMatrixGraph::rowData(int u) {
+    return bits.data() + static_cast<std::size_t>(u) * words;
+}
+
+// Count the set bits of the whole matrix.
+std::size_t BitMatrixGraph::countEdges() const {
+    std::size_t count = 0;
+    for (std::uint64_t w : bits) {
+        count += static_cast<std::size_t>(__builtin_popcountll(w));
+    }
+    return count;
+}
+
+// Return the number of bytes used by the bit storage.
+std::size_t BitMatrixGraph::memoryBytes() const {
+    return bits.size() * sizeof(std::uint64_t);
+}
+
+// Compute the transpose block by block.  Block (bi, bj) holds rows
+// 64*bi .. 64*bi+63 restricted to word bj of each row; after the
+// in‑register transpose its 64 words are the rows 64*bj .. 64*bj+63
+// of the result restricted to word bi.  Rows past n are zero.
+BitMatrixGraph BitMatrixGraph::getTranspose() const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::getTranspose");
+    LAB11_METRICS_EDGES(metrics, static_cast<std::uint64_t>(n) * n);
+    BitMatrixGraph gT(n);
+    std::uint64_t block[64];
+    for (std::size_t bi = 0; bi < words; ++bi) {
+        for (std::size_t bj = 0; bj < words; ++bj) {
+            for (int r = 0; r < 64; ++r) {
+                std::size_t i = bi * 64 + r;
+                block[r] = i < static_cast<std::size_t>(n) ? bits[i * words + bj] : 0;
+            }
+            transpose64(block);
+            for (int r = 0; r < 64; ++r) {
+                std::size_t j = bj * 64 + r;
+                if (j >= static_cast<std::size_t>(n)) break;
+                gT.bits[j * words + bi] = block[r];
+            }
+        }
+    }
+    return gT;
+}
+
+// Compute the square: start from a copy of the matrix and OR row k into
+// row i for every edge (i, k) of the original graph.
+BitMatrixGraph BitMatrixGraph::squareGraph() const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::squareGraph");
+    BitMatrixGraph g2(*this);
+    for (int i = 0; i < n; ++i) {
+        const std::uint64_t* src = row(i);
+        std::uint64_t* dst = g2.rowData(i);
+        for (std::size_t w = 0; w < words; ++w) {
+            for (std::uint64_t b = src[w]; b != 0; b &= b - 1) {
+                const std::uint64_t* rk = row(static_cast<int>(w * 64) + lowestBit(b));
+                LAB11_METRICS_EDGES(metrics, n);
+                for (std::size_t x = 0; x < words; ++x) {
+                    dst[x] |= rk[x];
+                }
+            }
+        }
+    }
+    return g2;
+}
+
+// Combine two partial powers: row i of the result is x_i | y_i OR'ed
+// with row k of y for every bit k set in x_i.
+BitMatrixGraph BitMatrixGraph::combine(const BitMatrixGraph& x, const BitMatrixGraph& y) {
+    BitMatrixGraph c(x.n);
+    std::size_t words = x.words;
+    for (int i = 0; i < x.n; ++i) {
+        const std::uint64_t* xi = x.row(i);
+        const std::uint64_t* yi = y.row(i);
+        std::uint64_t* dst = c.rowData(i);
+        for (std::size_t w = 0; w < words; ++w) {
+            dst[w] = xi[w] | yi[w];
+        }
+        for (std::size_t w = 0; w < words; ++w) {
+            for (std::uint64_t b = xi[w]; b != 0; b &= b - 1) {
+                const std::uint64_t* yk = y.row(static_cast<int>(w * 64) + lowestBit(b));
+                for (std::size_t t = 0; t < words; ++t) {
+                    dst[t] |= yk[t];
+                }
+            }
+        }
+    }
+    return c;
+}
+
+// Compute G^k by binary exponentiation over path lengths: base holds
+// R_(2^i) and is squared every round, result accumulates R_a for the
+// bits of k seen so far.  At most three matrices are alive at once.
+BitMatrixGraph BitMatrixGraph::power(int k, PowerReport* report) const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::power");
+    if (k > n) k = n;
+    if (k < 1) {
+        if (report) {
+            report->peakBytes = memoryBytes();
+            if (report->onProgress) report->onProgress(0, 0);
+        }
+        return BitMatrixGraph(n);
+    }
+    // Count the combine steps in advance for progress reporting.
+    std::size_t total = 0;
+    for (int e = k; e > 1; e >>= 1) {
+        total += (e & 1) ? 2 : 1;
+    }
+    std::size_t done = 0;
+    auto step = [&](std::size_t matrices) {
+        if (!report) return;
+        std::size_t live = matrices * memoryBytes();
+        if (live > report->peakBytes) report->peakBytes = live;
+        if (report->onProgress) report->onProgress(done, total);
+    };
+    if (report) report->peakBytes = 0;
+
+    BitMatrixGraph base(*this);
+    BitMatrixGraph result(0);
+    bool haveResult = false;
+    step(1);
+    for (int e = k; e > 0; e >>= 1) {
+        if (e & 1) {
+            if (haveResult) {
+                result = combine(result, base);
+                ++done;
+                step(3);
+            } else {
+                result = base;
+                haveResult = true;
+                step(2);
+            }
+        }
+        if (e > 1) {
+            base = combine(base, base);
+            ++done;
+            step(haveResult ? 3 : 2);
+        }
+    }
+    return result;
+}
+
+// Warshall's algorithm with whole rows as bit sets.  Row k itself may
+// change while pivot k is processed (if k reaches itself), which only
+// adds bits that are in the closure anyway.
+BitMatrixGraph BitMatrixGraph::transitiveClosure(PowerReport* report) const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::transitiveClosure");
+    BitMatrixGraph c(*this);
+    if (report) {
+        report->peakBytes = memoryBytes();
+    }
+    for (int k = 0; k < n; ++k) {
+        const std::uint64_t* rk = c.row(k);
+        std::uint64_t bit = std::uint64_t(1) << (k % 64);
+        std::size_t wk = static_cast<std::size_t>(k) / 64;
+        for (int i = 0; i < n; ++i) {
+            std::uint64_t* ri = c.rowData(i);
+            if ((ri[wk] & bit) == 0 || i == k) continue;
+            LAB11_METRICS_EDGES(metrics, n);
+            for (std::size_t w = 0; w < words; ++w) {
+                ri[w] |= rk[w];
+            }
+        }
+        if (report && report->onProgress && (k % 64 == 63 || k + 1 == n)) {
+            report->onProgress(static_cast<std::size_t>(k) + 1, n);
+        }
+    }
+    if (report && report->onProgress && n == 0) report->onProgress(0, 0);
+    return c;
+}
+
+// Perform BFS from start.  Visited vertices are kept as a bit set; the
+// new vertices reachable from u are row(u) & ~visited, computed one word
+// at a time and enumerated in ascending order.  The output vector is
+// also used as the queue.
+std::vector<int> BitMatrixGraph::BFS(int start) const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::BFS");
+    std::vector<int> order;
+    if (start < 0 || start >= n) return order;
+    std::vector<std::uint64_t> visited(words, 0);
+    order.reserve(n);
+    visited[start / 64] |= std::uint64_t(1) << (start % 64);
+    order.push_back(start);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        const std::uint64_t* r = row(order[head]);
+        LAB11_METRICS_QUEUE(metrics, head, order.size());
+        LAB11_METRICS_EDGES(metrics, n);
+        for (std::size_t w = 0; w < words; ++w) {
+            std::uint64_t fresh = r[w] & ~visited[w];
+            if (fresh == 0) continue;
+            visited[w] |= fresh;
+            for (; fresh != 0; fresh &= fresh - 1) {
+                order.push_back(static_cast<int>(w * 64) + lowestBit(fresh));
+            }
+        }
+    }
+    return order;
+}
+
+// Find a universal sink with the same elimination scheme as
+// GraphMatrix::findUniversalSink, then verify the candidate: its row
+// must be all zero words and every other row must have its column bit.
+int BitMatrixGraph::findUniversalSink() const {
+    LAB11_METRICS_SCOPE(metrics, "BitMatrixGraph::findUniversalSink");
+    int i = 0;
+    int j = 0;
+    while (i < n && j < n) {
+        if (hasEdge(i, j)) {
+            ++i;
+        } else {
+            ++j;
+        }
+    }
+    if (i >= n) {
+        return -1;
+    }
+    int candidate = i;
+    const std::uint64_t* r = row(candidate);
+    for (std::size_t w = 0; w < words; ++w) {
+        if (r[w] != 0) return -1;
+    }
+    for (int other = 0; other < n; ++other) {
+        if (other == candidate) continue;
+        if (!hasEdge(other, candidate)) return -1;
+    }
+    return candidate;
+}
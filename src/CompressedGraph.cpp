@@ -0,0 +1,171 @@
+// CompressedGraph.cpp
+// Implementation of CompressedGraph declared in CompressedGraph.h
+
+#include "../include/CompressedGraph.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+
+// Append value as an unsigned LEB128 varint.
+static void encodeVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+// Map a signed difference to an unsigned value with small magnitudes
+// first: 0, ‑1, 1, ‑2, ... become 0, 1, 2, 3, ...
+static std::uint64_t zigzag(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+// Construct an empty graph: every record is a single zero degree byte.
+CompressedGraph::CompressedGraph(int v)
+    : numVertices(v < 0 ? 0 : v), edgeCount(0) {
+    offsets.resize(static_cast<std::size_t>(numVertices) + 1);
+    bytes.assign(numVertices, 0);
+    for (int u = 0; u <= numVertices; ++u) {
+        offsets[u] = static_cast<std::uint64_t>(u);
+    }
+}
+
+// Degree, first neighbour relative to u, then the gaps.
+void CompressedGraph::appendRecord(int u, const int* first, const int* last) {
+    encodeVarint(bytes, static_cast<std::uint64_t>(last - first));
+    if (first != last) {
+        encodeVarint(bytes, zigzag(static_cast<std::int64_t>(*first) - u));
+        for (const int* p = first + 1; p != last; ++p) {
+            encodeVarint(bytes, static_cast<std::uint64_t>(*p - p[-1]));
+        }
+    }
+    edgeCount += static_cast<std::size_t>(last - first);
+}
+
+// Sort every list into a row buffer and append its record.
+CompressedGraph CompressedGraph::fromCsr(const CsrView& g) {
+    CompressedGraph cg(0);
+    cg.numVertices = g.size();
+    cg.offsets.assign(static_cast<std::size_t>(cg.numVertices) + 1, 0);
+    cg.bytes.clear();
+    // Most gaps of a sparse graph take one or two bytes.
+    cg.bytes.reserve(g.numEdges() * 2 + static_cast<std::size_t>(cg.numVertices));
+    std::vector<int> row;
+    for (int u = 0; u < cg.numVertices; ++u) {
+        NeighbourRange r = g.neighbours(u);
+        row.assign(r.begin(), r.end());
+        std::sort(row.begin(), row.end());
+        cg.offsets[u] = cg.bytes.size();
+        cg.appendRecord(u, row.data(), row.data() + row.size());
+    }
+    cg.offsets[cg.numVertices] = cg.bytes.size();
+    cg.bytes.shrink_to_fit();
+    return cg;
+}
+
+CompressedGraph CompressedGraph::fromGraph(const Graph& g) {
+    return fromCsr(CsrGraph::fromGraph(g));
+}
+
+// Decode every list in turn.
+CsrGraph CompressedGraph::toCsrGraph() const {
+    std::vector<std::uint64_t> csrOffsets(static_cast<std::size_t>(numVertices) + 1, 0);
+    std::vector<int> targets;
+    targets.reserve(edgeCount);
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v : neighbours(u)) {
+            targets.push_back(v);
+        }
+        csrOffsets[u + 1] = targets.size();
+    }
+    return CsrGraph::fromArrays(numVertices, std::move(csrOffsets), std::move(targets));
+}
+
+// Return the number of vertices.
+int CompressedGraph::size() const {
+    return numVertices;
+}
+
+// Return the number of edges.
+std::size_t CompressedGraph::numEdges() const {
+    return edgeCount;
+}
+
+// The degree is the first varint of the record.
+int CompressedGraph::degree(int u) const {
+    const std::uint8_t* p = bytes.data() + offsets[u];
+    return static_cast<int>(decodeVarint(p));
+}
+
+// Skip the degree; the range decodes the rest.
+CompressedNeighbours CompressedGraph::neighbours(int u) const {
+    const std::uint8_t* p = bytes.data() + offsets[u];
+    int count = static_cast<int>(decodeVarint(p));
+    return CompressedNeighbours{p, count, u};
+}
+
+// Encoded lists plus the offset array.
+std::size_t CompressedGraph::memoryBytes() const {
+    return bytes.size() + offsets.size() * sizeof(std::uint64_t);
+}
+
+// BFS with the visit order as the queue.
+std::vector<int> CompressedGraph::BFS(int start) const {
+    LAB11_METRICS_SCOPE(metrics, "CompressedGraph::BFS");
+    std::vector<int> order;
+    if (start < 0 || start >= numVertices) return order;
+    std::vector<bool> visited(numVertices, false);
+    order.reserve(numVertices);
+    visited[start] = true;
+    order.push_back(start);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        LAB11_METRICS_QUEUE(metrics, head, order.size());
+        CompressedNeighbours out = neighbours(order[head]);
+        LAB11_METRICS_EDGES(metrics, out.size());
+        for (int v : out) {
+            if (!visited[v]) {
+                visited[v] = true;
+                order.push_back(v);
+            }
+        }
+    }
+    return order;
+}
+
+// Collect every row with marks cleared through the row itself, sort it
+// and encode it right away, so only one decoded row exists at a time.
+CompressedGraph CompressedGraph::squareGraph() const {
+    LAB11_METRICS_SCOPE(metrics, "CompressedGraph::squareGraph");
+    CompressedGraph g2(0);
+    g2.numVertices = numVertices;
+    g2.offsets.assign(static_cast<std::size_t>(numVertices) + 1, 0);
+    g2.bytes.clear();
+    std::vector<bool> marked(numVertices, false);
+    std::vector<int> row;
+    for (int u = 0; u < numVertices; ++u) {
+        row.clear();
+        for (int v : neighbours(u)) {
+            if (v != u && !marked[v]) {
+                marked[v] = true;
+                row.push_back(v);
+            }
+            CompressedNeighbours second = neighbours(v);
+            LAB11_METRICS_EDGES(metrics, second.size());
+            for (int w : second) {
+                if (w != u && !marked[w]) {
+                    marked[w] = true;
+                    row.push_back(w);
+                }
+            }
+        }
+        for (int w : row) {
+            marked[w] = false;
+        }
+        std::sort(row.begin(), row.end());
+        g2.offsets[u] = g2.bytes.size();
+        g2.appendRecord(u, row.data(), row.data() + row.size());
+    }
+    g2.offsets[numVertices] = g2.bytes.size();
+    g2.bytes.shrink_to_fit();
+    return g2;
+}
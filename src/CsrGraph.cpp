@@ -0,0 +1,414 @@
+// CsrGraph.cpp
+// Implementation of the CsrGraph class declared in CsrGraph.h
+
+#include "../include/CsrGraph.h"
+#include "../include/GraphKernels.h"
+#include "../include/Metrics.h"
+#include "../include/RadixSort.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+// Construct an empty graph with v vertices and no edges.
+CsrGraph::CsrGraph(int v)
+    : numVertices(v < 0 ? 0 : v), offsets(numVertices + 1, 0) {}
+
+// Take ownership of already built offset and target arrays.
+CsrGraph::CsrGraph(int v, std::vector<std::uint64_t> offsets, std::vector<int> targets)
+    : numVertices(v), offsets(std::move(offsets)), targets(std::move(targets)) {}
+
+// First index of part p when [0, total) is split into parts equal blocks.
+static std::size_t partBegin(std::size_t total, int p, int parts) {
+    return total * static_cast<std::size_t>(p) / static_cast<std::size_t>(parts);
+}
+
+// Replace a[0 .. count) by its inclusive prefix sums.  Every thread sums
+// its block, a serial pass over the block totals gives every block its
+// carry, and every thread then scans its block again from that carry.
+static void prefixSum(std::uint64_t* a, std::size_t count, ThreadPool* pool) {
+    const int parts = threadCount(pool);
+    std::vector<std::uint64_t> carry(parts + 1, 0);
+    runOnThreads(pool, [&](int t) {
+        std::uint64_t total = 0;
+        for (std::size_t i = partBegin(count, t, parts); i < partBegin(count, t + 1, parts); ++i) {
+            total += a[i];
+        }
+        carry[t + 1] = total;
+    });
+    for (int t = 0; t < parts; ++t) {
+        carry[t + 1] += carry[t];
+    }
+    runOnThreads(pool, [&](int t) {
+        std::uint64_t running = carry[t];
+        for (std::size_t i = partBegin(count, t, parts); i < partBegin(count, t + 1, parts); ++i) {
+            running += a[i];
+            a[i] = running;
+        }
+    });
+}
+
+// Number of per‑part histograms countingBuild can afford for v
+// vertices and about edges edges: one per thread, but no more than
+// edges / v, so that the histograms never take more than max(V, E)
+// entries.  Fewer parts only mean fewer threads in the counting and
+// scatter passes; the result does not change.
+static int histogramParts(int threads, std::size_t v, std::uint64_t edges) {
+    if (v == 0) return threads;
+    std::uint64_t affordable = std::max<std::uint64_t>(1, edges / v);
+    return static_cast<int>(std::min<std::uint64_t>(threads, affordable));
+}
+
+// Counting sort on the source vertex over edges delivered in parts:
+// scan(t, parts, visit) calls visit(u, v) for every edge of part t of
+// parts, in the same order on both calls.  Thread t owns part t and
+// histogram t; after the counting pass, entry (t, u) of the histograms
+// is turned into the first slot part t may write for source u, which is
+// offsets[u] plus the edges of u in the parts before t, so parts are
+// scattered in order and no two threads share a slot.  With one part
+// this is the plain two‑pass counting sort.  edges is the expected
+// number of edges and only bounds the number of parts (see
+// histogramParts).  Every array is allocated exactly once.
+template <typename Scan>
+static CsrGraph countingBuild(int v, Scan scan, std::uint64_t edges,
+                              const EdgeBuildOptions& options, ThreadPool* pool) {
+    const int threads = threadCount(pool);
+    const std::size_t n = static_cast<std::size_t>(v);
+    const int parts = histogramParts(threads, n, edges);
+
+    // Per‑part degree histograms, each cleared by its owner.
+    std::unique_ptr<std::uint64_t[]> slots(new std::uint64_t[static_cast<std::size_t>(parts) * n]);
+    runOnThreads(pool, [&](int t) {
+        if (t >= parts) return;
+        std::uint64_t* hist = slots.get() + static_cast<std::size_t>(t) * n;
+        std::fill(hist, hist + n, 0);
+        scan(t, parts, [hist](int a, int) { ++hist[a]; });
+    });
+
+    // Degrees, then offsets.
+    std::vector<std::uint64_t> offs(n + 1, 0);
+    runOnThreads(pool, [&](int t) {
+        for (std::size_t u = partBegin(n, t, threads); u < partBegin(n, t + 1, threads); ++u) {
+            std::uint64_t degree = 0;
+            for (int p = 0; p < parts; ++p) {
+                degree += slots[static_cast<std::size_t>(p) * n + u];
+            }
+            offs[u + 1] = degree;
+        }
+    });
+    prefixSum(offs.data() + 1, n, pool);
+
+    // Histogram counts become write positions.
+    runOnThreads(pool, [&](int t) {
+        for (std::size_t u = partBegin(n, t, threads); u < partBegin(n, t + 1, threads); ++u) {
+            std::uint64_t running = offs[u];
+            for (int p = 0; p < parts; ++p) {
+                std::uint64_t& slot = slots[static_cast<std::size_t>(p) * n + u];
+                std::uint64_t count = slot;
+                slot = running;
+                running += count;
+            }
+        }
+    });
+
+    std::vector<int> tgts(offs[n]);
+    runOnThreads(pool, [&](int t) {
+        if (t >= parts) return;
+        std::uint64_t* pos = slots.get() + static_cast<std::size_t>(t) * n;
+        int* out = tgts.data();
+        scan(t, parts, [pos, out](int a, int b) { out[pos[a]++] = b; });
+    });
+    slots.reset();
+
+    if (options.sortNeighbours || options.removeDuplicates) {
+        // Sort every list; with deduplication, kept[u + 1] receives the
+        // length of list u after std::unique and the lists are packed.
+        std::vector<std::uint64_t> kept(n + 1, 0);
+        auto tidy = [&](int, std::size_t begin, std::size_t end) {
+            for (std::size_t u = begin; u < end; ++u) {
+                int* first = tgts.data() + offs[u];
+                int* last = tgts.data() + offs[u + 1];
+                std::sort(first, last);
+                if (options.removeDuplicates) last = std::unique(first, last);
+                kept[u + 1] = static_cast<std::uint64_t>(last - first);
+            }
+        };
+        parallelFor(pool, n, 1024, tidy);
+        if (options.removeDuplicates) {
+            prefixSum(kept.data() + 1, n, pool);
+            std::vector<int> packed(kept[n]);
+            auto pack = [&](int, std::size_t begin, std::size_t end) {
+                for (std::size_t u = begin; u < end; ++u) {
+                    std::copy(tgts.begin() + offs[u], tgts.begin() + offs[u] + (kept[u + 1] - kept[u]),
+                              packed.begin() + kept[u]);
+                }
+            };
+            parallelFor(pool, n, 1024, pack);
+            offs.swap(kept);
+            tgts.swap(packed);
+        }
+    }
+    return CsrGraph::fromArrays(v, std::move(offs), std::move(tgts));
+}
+
+// Part t is the t‑th contiguous slice of the edge array.
+CsrGraph CsrGraph::fromEdges(int v, const EdgeList& edges, const EdgeBuildOptions& options,
+                             ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "CsrGraph::fromEdges");
+    LAB11_METRICS_EDGES(metrics, edges.size());
+    if (v < 0) v = 0;
+    const std::size_t m = edges.size();
+    auto scan = [&](int t, int parts, auto visit) {
+        for (std::size_t i = partBegin(m, t, parts); i < partBegin(m, t + 1, parts); ++i) {
+            const std::pair<int, int>& e = edges[i];
+            if (e.first >= 0 && e.first < v && e.second >= 0 && e.second < v) {
+                visit(e.first, e.second);
+            }
+        }
+    };
+    return countingBuild(v, scan, m, options, pool);
+}
+
+// Part t is the t‑th contiguous range of chunks; each chunk is generated
+// into the thread's buffer and then scanned.
+CsrGraph CsrGraph::fromEdgeChunks(int v, std::size_t chunks, const EdgeChunkSource& generate,
+                                  const EdgeBuildOptions& options, ThreadPool* pool,
+                                  std::uint64_t expectedEdges) {
+    LAB11_METRICS_SCOPE(metrics, "CsrGraph::fromEdgeChunks");
+    if (v < 0) v = 0;
+    std::vector<EdgeList> buffers(threadCount(pool));
+    auto scan = [&](int t, int parts, auto visit) {
+        EdgeList& buffer = buffers[t];
+        for (std::size_t c = partBegin(chunks, t, parts); c < partBegin(chunks, t + 1, parts); ++c) {
+            buffer.clear();
+            generate(c, buffer);
+            for (const std::pair<int, int>& e : buffer) {
+                if (e.first >= 0 && e.first < v && e.second >= 0 && e.second < v) {
+                    visit(e.first, e.second);
+                }
+            }
+        }
+    };
+    return countingBuild(v, scan, expectedEdges, options, pool);
+}
+
+// Adopt prebuilt arrays without validation.
+CsrGraph CsrGraph::fromArrays(int v, std::vector<std::uint64_t> offsets,
+                              std::vector<int> targets) {
+    return CsrGraph(v, std::move(offsets), std::move(targets));
+}
+
+// Copy the adjacency lists of g into the flat arrays.
+CsrGraph CsrGraph::fromGraph(const Graph& g) {
+    const auto& adj = g.getAdjacencyList();
+    int v = g.size();
+    std::vector<std::uint64_t> offs(v + 1, 0);
+    for (int u = 0; u < v; ++u) {
+        offs[u + 1] = offs[u] + adj[u].size();
+    }
+    std::vector<int> tgts(offs[v]);
+    for (int u = 0; u < v; ++u) {
+        std::copy(adj[u].begin(), adj[u].end(), tgts.begin() + offs[u]);
+    }
+    return CsrGraph(v, std::move(offs), std::move(tgts));
+}
+
+// Convert back into an adjacency‑list graph.
+Graph CsrGraph::toGraph() const {
+    Graph g(numVertices);
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v : neighbours(u)) {
+            g.addEdge(u, v);
+        }
+    }
+    return g;
+}
+
+// Return the number of vertices.
+int CsrGraph::size() const {
+    return numVertices;
+}
+
+// Return the number of directed edges.
+std::size_t CsrGraph::numEdges() const {
+    return targets.size();
+}
+
+// Return the out‑degree of vertex u.
+int CsrGraph::degree(int u) const {
+    return static_cast<int>(offsets[u + 1] - offsets[u]);
+}
+
+// Return the out‑neighbours of vertex u.
+NeighbourRange CsrGraph::neighbours(int u) const {
+    const int* base = targets.data();
+    return NeighbourRange{base + offsets[u], base + offsets[u + 1]};
+}
+
+// Return a view of the arrays.
+CsrView CsrGraph::view() const {
+    return CsrView(numVertices, offsets.data(), targets.data());
+}
+
+// Return the raw offset array.
+const std::vector<std::uint64_t>& CsrGraph::getOffsets() const {
+    return offsets;
+}
+
+// Return the raw target array.
+const std::vector<int>& CsrGraph::getTargets() const {
+    return targets;
+}
+
+// Compute the transpose with a counting sort on the target vertex.
+// Sources are visited in ascending order, so every reversed list is
+// sorted by source exactly as Graph::getTranspose produces it.
+CsrGraph CsrGraph::getTranspose() const {
+    LAB11_METRICS_SCOPE(metrics, "CsrGraph::getTranspose");
+    LAB11_METRICS_EDGES(metrics, targets.size());
+    std::vector<std::uint64_t> offs(numVertices + 1, 0);
+    for (int v : targets) {
+        ++offs[v + 1];
+    }
+    for (int u = 0; u < numVertices; ++u) {
+        offs[u + 1] += offs[u];
+    }
+    std::vector<int> tgts(targets.size());
+    std::vector<std::uint64_t> pos(offs.begin(), offs.end() - 1);
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v : neighbours(u)) {
+            tgts[pos[v]++] = u;
+        }
+    }
+    return CsrGraph(numVertices, std::move(offs), std::move(tgts));
+}
+
+// Compute the square of the graph with the squareArrays kernel: for
+// every source u the vertices already emitted are marked, and only the
+// marks of the row are cleared afterwards, so no O(V) reset is needed.
+CsrGraph CsrGraph::squareGraph() const {
+    CsrArrays<int> g2 = squareArrays<UncheckedAccess>(storageOf(view()), "CsrGraph::squareGraph");
+    return CsrGraph(numVertices, std::move(g2.offsets), std::move(g2.targets));
+}
+
+// Paths of length at most k; longer paths add nothing once k reaches n.
+CsrGraph CsrGraph::power(int k, PowerReport* report) const {
+    if (k < 1) {
+        if (report) {
+            report->peakBytes = 0;
+            if (report->onProgress) report->onProgress(0, 0);
+        }
+        return CsrGraph(numVertices);
+    }
+    return boundedReach(k, report);
+}
+
+// Reachability without a depth limit.
+CsrGraph CsrGraph::transitiveClosure(PowerReport* report) const {
+    return boundedReach(-1, report);
+}
+
+// Run a BFS from every source u, appending the reached vertices straight
+// to the output arrays.  Visited marks are stamped with the source index,
+// so they never need clearing; the output row itself serves as the BFS
+// queue, with level boundaries tracked to stop at the requested depth.
+CsrGraph CsrGraph::boundedReach(int depth, PowerReport* report) const {
+    LAB11_METRICS_SCOPE(metrics, depth < 0 ? "CsrGraph::transitiveClosure" : "CsrGraph::power");
+    std::vector<std::uint64_t> offs(numVertices + 1, 0);
+    std::vector<int> tgts;
+    std::vector<int> stamp(numVertices, -1);
+    std::size_t scratchBytes = stamp.size() * sizeof(int) + offs.size() * sizeof(std::uint64_t);
+    if (report) report->peakBytes = scratchBytes;
+    for (int u = 0; u < numVertices; ++u) {
+        std::size_t rowStart = tgts.size();
+        stamp[u] = u;
+        // Level 1: direct neighbours of u.
+        for (int v : neighbours(u)) {
+            if (stamp[v] == u) continue;
+            stamp[v] = u;
+            tgts.push_back(v);
+        }
+        std::size_t levelBegin = rowStart;
+        std::size_t reachLimit = static_cast<std::size_t>(numVertices - 1);
+        for (int level = 1; depth < 0 || level < depth; ++level) {
+            std::size_t levelEnd = tgts.size();
+            if (levelBegin == levelEnd || levelEnd - rowStart == reachLimit) break;
+            for (std::size_t i = levelBegin; i < levelEnd; ++i) {
+                LAB11_METRICS_EDGES(metrics, degree(tgts[i]));
+                for (int w : neighbours(tgts[i])) {
+                    if (stamp[w] == u) continue;
+                    stamp[w] = u;
+                    tgts.push_back(w);
+                }
+            }
+            levelBegin = levelEnd;
+        }
+        offs[u + 1] = tgts.size();
+        if (report) {
+            std::size_t live = scratchBytes + tgts.capacity() * sizeof(int);
+            if (live > report->peakBytes) report->peakBytes = live;
+            if (report->onProgress && ((u & 1023) == 1023 || u + 1 == numVertices)) {
+                report->onProgress(static_cast<std::size_t>(u) + 1, numVertices);
+            }
+        }
+    }
+    tgts.shrink_to_fit();
+    return CsrGraph(numVertices, std::move(offs), std::move(tgts));
+}
+
+// Perform a BFS from start with the generic kernel, which uses the
+// output vector as the queue.  The builders drop out‑of‑range targets,
+// so only start is checked.
+std::vector<int> CsrGraph::BFS(int start) const {
+    if (start < 0 || start >= numVertices) return std::vector<int>();
+    return bfsVisitOrder<UncheckedAccess>(storageOf(view()), start, "CsrGraph::BFS");
+}
+
+// Convert to a simple undirected graph.  Edges become packed
+// (min, max) keys, loops the all‑ones key; after radix sort and dedup
+// the degrees give the offsets and one ordered scatter fills the sorted
+// lists (see Graph::toSimpleUndirected).
+CsrGraph CsrGraph::toSimpleUndirected(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, "CsrGraph::toSimpleUndirected");
+    LAB11_METRICS_EDGES(metrics, targets.size());
+    int bits = bitsFor(numVertices > 0 ? numVertices - 1 : 0);
+    std::uint64_t lowMask = (std::uint64_t(1) << bits) - 1;
+    std::uint64_t loopKey = (std::uint64_t(1) << (2 * bits)) - 1;
+
+    std::vector<std::uint64_t> keys(targets.size());
+    auto emit = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t u = begin; u < end; ++u) {
+            for (std::uint64_t i = offsets[u]; i < offsets[u + 1]; ++i) {
+                std::uint64_t a = std::min<std::uint64_t>(u, targets[i]);
+                std::uint64_t b = std::max<std::uint64_t>(u, targets[i]);
+                keys[i] = (a == b) ? loopKey : (a << bits) | b;
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(numVertices, 4096,
+                          [&](int, std::size_t begin, std::size_t end) { emit(begin, end); });
+    } else {
+        emit(0, numVertices);
+    }
+    radixSortUnique(keys, 2 * bits, pool);
+    if (!keys.empty() && keys.back() == loopKey) keys.pop_back();
+
+    std::vector<std::uint64_t> offs(numVertices + 1, 0);
+    for (std::uint64_t key : keys) {
+        ++offs[(key >> bits) + 1];
+        ++offs[(key & lowMask) + 1];
+    }
+    for (int u = 0; u < numVertices; ++u) {
+        offs[u + 1] += offs[u];
+    }
+    std::vector<int> tgts(offs[numVertices]);
+    std::vector<std::uint64_t> pos(offs.begin(), offs.end() - 1);
+    for (std::uint64_t key : keys) {
+        int a = static_cast<int>(key >> bits);
+        int b = static_cast<int>(key & lowMask);
+        tgts[pos[a]++] = b;
+        tgts[pos[b]++] = a;
+    }
+    return CsrGraph(numVertices, std::move(offs), std::move(tgts));
+}
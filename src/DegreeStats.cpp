@@ -0,0 +1,249 @@
+// DegreeStats.cpp
+// Implementation of the degree statistics declared in DegreeStats.h
+
+#include "../include/DegreeStats.h"
+#include "../include/GraphKernels.h"
+#include "../include/Metrics.h"
+#include "../include/SimdKernels.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+// Degree arrays and per‑thread scratch shared by the list and the
+// matrix versions.  localIn[t] holds the in‑degree counts of thread
+// t > 0; thread 0 counts straight into in.
+struct DegreeCounts {
+    std::vector<int> out;
+    std::vector<int> in;
+    std::vector<std::vector<int>> localIn;
+
+    // Return the in‑degree counters of thread t, allocating them on
+    // first use.
+    int* countersFor(int t, int n) {
+        if (t == 0) return in.data();
+        if (localIn[t].empty()) localIn[t].assign(n, 0);
+        return localIn[t].data();
+    }
+};
+
+bool needsInDegrees(const DegreeStatsRequest& request) {
+    return request.inDegrees || request.sourcesAndSinks || request.histograms;
+}
+
+} // namespace
+
+// First vertex of part p when n vertices are split into parts.
+static int partBegin(int n, int p, int parts) {
+    return static_cast<int>(static_cast<long long>(n) * p / parts);
+}
+
+// Add 1 to histogram[d], growing it as needed.
+static void countDegree(std::vector<std::uint64_t>& histogram, int d) {
+    if (static_cast<std::size_t>(d) >= histogram.size()) histogram.resize(d + 1, 0);
+    ++histogram[d];
+}
+
+// Add part into total, growing total as needed.
+static void mergeHistogram(std::vector<std::uint64_t>& total, const std::vector<std::uint64_t>& part) {
+    if (part.size() > total.size()) total.resize(part.size(), 0);
+    for (std::size_t d = 0; d < part.size(); ++d) total[d] += part[d];
+}
+
+// Sum the per‑thread in‑degree counters into counts.in, then collect
+// the histograms and the source and sink lists over contiguous vertex
+// ranges, one per thread, and merge them in range order.  Finally move
+// the requested degree arrays into stats.
+static void collect(DegreeStats& stats, DegreeCounts& counts, const DegreeStatsRequest& request,
+                    ThreadPool* pool) {
+    const int n = static_cast<int>(counts.out.size());
+    const int parts = threadCount(pool);
+    const bool haveIn = needsInDegrees(request);
+    std::vector<std::vector<std::uint64_t>> outHist(parts), inHist(parts);
+    std::vector<std::vector<int>> sources(parts), sinks(parts);
+    runOnThreads(pool, [&](int p) {
+        int first = partBegin(n, p, parts);
+        int last = partBegin(n, p + 1, parts);
+        if (haveIn) {
+            for (std::size_t t = 1; t < counts.localIn.size(); ++t) {
+                const std::vector<int>& local = counts.localIn[t];
+                if (local.empty()) continue;
+                for (int v = first; v < last; ++v) counts.in[v] += local[v];
+            }
+        }
+        for (int v = first; v < last; ++v) {
+            if (request.histograms) {
+                countDegree(outHist[p], counts.out[v]);
+                countDegree(inHist[p], counts.in[v]);
+            }
+            if (request.sourcesAndSinks) {
+                if (counts.in[v] == 0) sources[p].push_back(v);
+                if (counts.out[v] == 0) sinks[p].push_back(v);
+            }
+        }
+    });
+    for (int p = 0; p < parts; ++p) {
+        if (request.histograms) {
+            mergeHistogram(stats.outHistogram, outHist[p]);
+            mergeHistogram(stats.inHistogram, inHist[p]);
+        }
+        if (request.sourcesAndSinks) {
+            stats.sources.insert(stats.sources.end(), sources[p].begin(), sources[p].end());
+            stats.sinks.insert(stats.sinks.end(), sinks[p].begin(), sinks[p].end());
+        }
+    }
+    if (request.outDegrees) stats.outDegree = std::move(counts.out);
+    if (request.inDegrees) stats.inDegree = std::move(counts.in);
+}
+
+// Return the only vertex with out‑degree 0, or ‑1 if there are none or
+// several: the one possible universal sink.
+static int sinkCandidate(const std::vector<int>& out, ThreadPool* pool) {
+    const int n = static_cast<int>(out.size());
+    const int parts = threadCount(pool);
+    std::vector<int> zeros(parts, 0);
+    std::vector<int> vertex(parts, -1);
+    runOnThreads(pool, [&](int p) {
+        for (int v = partBegin(n, p, parts); v < partBegin(n, p + 1, parts); ++v) {
+            if (out[v] == 0) {
+                ++zeros[p];
+                vertex[p] = v;
+            }
+        }
+    });
+    int candidate = -1;
+    int total = 0;
+    for (int p = 0; p < parts; ++p) {
+        total += zeros[p];
+        if (zeros[p] > 0) candidate = vertex[p];
+    }
+    return total == 1 ? candidate : -1;
+}
+
+// One pass over the edges for the in‑degrees and the sink test; g is a
+// storage policy of GraphKernels.h.
+template <typename Storage>
+static DegreeStats listStats(int n, const Storage& g, const DegreeStatsRequest& request,
+                             ThreadPool* pool) {
+    DegreeStats stats;
+    DegreeCounts counts;
+    const int parts = threadCount(pool);
+    counts.out.resize(n);
+    runOnThreads(pool, [&](int p) {
+        for (int u = partBegin(n, p, parts); u < partBegin(n, p + 1, parts); ++u) {
+            counts.out[u] = static_cast<int>(g.degree(u));
+        }
+    });
+    const bool haveIn = needsInDegrees(request);
+    const int candidate = request.universalSink ? sinkCandidate(counts.out, pool) : -1;
+    std::vector<long long> hits(parts, 0);
+    if (haveIn || candidate != -1) {
+        if (haveIn) {
+            counts.in.assign(n, 0);
+            counts.localIn.resize(parts);
+        }
+        parallelFor(pool, static_cast<std::size_t>(n), 1024,
+                    [&](int t, std::size_t begin, std::size_t end) {
+            int* in = haveIn ? counts.countersFor(t, n) : nullptr;
+            long long found = 0;
+            for (std::size_t u = begin; u < end; ++u) {
+                bool hit = false;
+                g.forEachNeighbour(static_cast<int>(u), [&](int w) {
+                    if (in) ++in[w];
+                    hit |= w == candidate;
+                });
+                found += hit;
+            }
+            hits[t] += found;
+        });
+    }
+    if (candidate != -1) {
+        long long total = 0;
+        for (long long h : hits) total += h;
+        if (total == n - 1) stats.universalSink = candidate;
+    }
+    collect(stats, counts, request, pool);
+    return stats;
+}
+
+DegreeStats computeDegreeStats(const CsrView& g, const DegreeStatsRequest& request,
+                               ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "computeDegreeStats");
+    LAB11_METRICS_EDGES(metrics, g.numEdges());
+    return listStats(g.size(), storageOf(g), request, pool);
+}
+
+DegreeStats computeDegreeStats(const Graph& g, const DegreeStatsRequest& request,
+                               ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "computeDegreeStats(list)");
+    return listStats(g.size(), storageOf(g), request, pool);
+}
+
+// Count every row of the matrix with the cell kernels.  With the
+// in‑degrees at hand, the sink is the only vertex with out‑degree 0 if
+// its in‑degree is n ‑ 1: a matrix has no parallel edges, and the sink
+// has no loop.
+template <typename Cell>
+DegreeStats computeDegreeStats(const DenseGraphMatrix<Cell>& g, const DegreeStatsRequest& request,
+                               ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, sizeof(Cell) == 1 ? "computeDegreeStats(ByteGraphMatrix)"
+                                                   : "computeDegreeStats(GraphMatrix)");
+    DegreeStats stats;
+    const int n = g.size();
+    const bool haveIn = needsInDegrees(request);
+    if (!haveIn && !request.outDegrees) {
+        if (request.universalSink) stats.universalSink = g.findUniversalSink();
+        return stats;
+    }
+    LAB11_METRICS_EDGES(metrics, static_cast<std::uint64_t>(n) * n);
+    DegreeCounts counts;
+    counts.out.resize(n);
+    if (haveIn) {
+        counts.in.assign(n, 0);
+        counts.localIn.resize(threadCount(pool));
+    }
+    const std::size_t cells = static_cast<std::size_t>(n);
+    parallelFor(pool, cells, 64, [&](int t, std::size_t begin, std::size_t end) {
+        int* in = haveIn ? counts.countersFor(t, n) : nullptr;
+        for (std::size_t u = begin; u < end; ++u) {
+            const Cell* row = g.row(static_cast<int>(u));
+            counts.out[u] = static_cast<int>(countNonzeroCells(row, cells, sizeof(Cell)));
+            if (in) addNonzeroCells(in, row, cells, sizeof(Cell));
+        }
+    });
+    if (request.universalSink) {
+        if (haveIn) {
+            int candidate = sinkCandidate(counts.out, pool);
+            if (candidate != -1 && counts.in[candidate] == n - 1) stats.universalSink = candidate;
+        } else {
+            stats.universalSink = g.findUniversalSink();
+        }
+    }
+    collect(stats, counts, request, pool);
+    return stats;
+}
+
+template DegreeStats computeDegreeStats(const DenseGraphMatrix<int>&, const DegreeStatsRequest&,
+                                        ThreadPool*);
+template DegreeStats computeDegreeStats(const DenseGraphMatrix<std::uint8_t>&,
+                                        const DegreeStatsRequest&, ThreadPool*);
+
+// Ask for the sink alone: one O(V) pass over the list sizes and one
+// pass over the edges that only looks for the candidate.
+static DegreeStatsRequest sinkOnly() {
+    DegreeStatsRequest request;
+    request.outDegrees = false;
+    request.inDegrees = false;
+    request.sourcesAndSinks = false;
+    request.histograms = false;
+    return request;
+}
+
+int findUniversalSink(const CsrView& g, ThreadPool* pool) {
+    return computeDegreeStats(g, sinkOnly(), pool).universalSink;
+}
+
+int findUniversalSink(const Graph& g, ThreadPool* pool) {
+    return computeDegreeStats(g, sinkOnly(), pool).universalSink;
+}
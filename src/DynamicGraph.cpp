@@ -0,0 +1,189 @@
+// DynamicGraph.cpp
+// Implementation of DynamicGraph declared in DynamicGraph.h
+
+#include "../include/DynamicGraph.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+
+// Construct an empty graph with v vertices.
+DynamicGraph::DynamicGraph(int v)
+    : numVertices(v < 0 ? 0 : v),
+      edgeCount(0),
+      squareCount(0),
+      out(numVertices),
+      in(numVertices),
+      square(numVertices) {}
+
+// Insert the edges of g one by one.
+DynamicGraph DynamicGraph::fromGraph(const Graph& g) {
+    DynamicGraph dg(g.size());
+    const auto& adj = g.getAdjacencyList();
+    for (int u = 0; u < g.size(); ++u) {
+        for (int v : adj[u]) {
+            dg.addEdge(u, v);
+        }
+    }
+    return dg;
+}
+
+// Return the number of vertices.
+int DynamicGraph::size() const {
+    return numVertices;
+}
+
+// Return the number of edges.
+std::size_t DynamicGraph::numEdges() const {
+    return edgeCount;
+}
+
+// Return the number of edges of G^2.
+std::size_t DynamicGraph::numSquareEdges() const {
+    return squareCount;
+}
+
+// Add delta to c(u, w).  Loops are not part of G^2 and are not stored.
+void DynamicGraph::addPaths(int u, int w, long long delta) {
+    if (u == w) return;
+    PathMap& row = square[u];
+    auto it = row.find(w);
+    if (it == row.end()) {
+        row.emplace(w, delta);
+        ++squareCount;
+    } else if ((it->second += delta) == 0) {
+        row.erase(it);
+        --squareCount;
+    }
+}
+
+// With E the matrix of a single edge (a, b), (A + E) + (A + E)^2 differs
+// from A + A^2 by E + E A + A E + E E: the direct edge, row b of A added
+// to row a, column a of A added to column b, and E E, which is non‑zero
+// only at the loop (a, a) and so never stored.  Removing the edge from
+// A' = A + E changes the sums by ‑(E + E A' + A' E) + E E, the same
+// terms taken while the edge is still present, with the opposite sign.
+void DynamicGraph::updateSquare(int a, int b, long long sign) {
+    addPaths(a, b, sign);
+    // Paths a -> b -> w.
+    for (const auto& e : out[b]) {
+        addPaths(a, e.first, sign * e.second);
+    }
+    // Paths x -> a -> b.
+    for (const auto& e : in[a]) {
+        addPaths(e.first, b, sign * e.second);
+    }
+}
+
+// Update G^2 from the old multiplicities, then record the edge.
+void DynamicGraph::addEdge(int u, int v) {
+    if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) return;
+    updateSquare(u, v, 1);
+    ++out[u][v];
+    ++in[v][u];
+    ++edgeCount;
+}
+
+// Update G^2 from the multiplicities that still include the edge, then
+// drop one copy of it.
+bool DynamicGraph::removeEdge(int u, int v) {
+    if (u < 0 || u >= numVertices || v < 0 || v >= numVertices) return false;
+    auto it = out[u].find(v);
+    if (it == out[u].end()) return false;
+    updateSquare(u, v, -1);
+    if (--it->second == 0) out[u].erase(it);
+    auto jt = in[v].find(u);
+    if (--jt->second == 0) in[v].erase(jt);
+    --edgeCount;
+    return true;
+}
+
+// Insert, then remove.
+std::size_t DynamicGraph::applyBatch(const EdgeList& added, const EdgeList& removed) {
+    LAB11_METRICS_SCOPE(metrics, "DynamicGraph::applyBatch");
+    LAB11_METRICS_EDGES(metrics, added.size() + removed.size());
+    for (const auto& e : added) {
+        addEdge(e.first, e.second);
+    }
+    std::size_t found = 0;
+    for (const auto& e : removed) {
+        if (removeEdge(e.first, e.second)) ++found;
+    }
+    return found;
+}
+
+// Return the multiplicity of the edge (u, v).
+int DynamicGraph::multiplicity(int u, int v) const {
+    if (u < 0 || u >= numVertices) return 0;
+    auto it = out[u].find(v);
+    return it == out[u].end() ? 0 : it->second;
+}
+
+// Return true if (u, w) is an edge of G^2.
+bool DynamicGraph::hasSquareEdge(int u, int w) const {
+    return squarePathCount(u, w) > 0;
+}
+
+// Return c(u, w).
+long long DynamicGraph::squarePathCount(int u, int w) const {
+    if (u < 0 || u >= numVertices) return 0;
+    auto it = square[u].find(w);
+    return it == square[u].end() ? 0 : it->second;
+}
+
+// Maintained neighbourhoods.  No bounds checking is performed.
+const DynamicGraph::EdgeMap& DynamicGraph::outEdges(int u) const {
+    return out[u];
+}
+
+const DynamicGraph::EdgeMap& DynamicGraph::inEdges(int u) const {
+    return in[u];
+}
+
+const DynamicGraph::PathMap& DynamicGraph::squareEdges(int u) const {
+    return square[u];
+}
+
+// Emit every key once per copy and sort each list.
+Graph DynamicGraph::listsFrom(const std::vector<EdgeMap>& maps) {
+    int n = static_cast<int>(maps.size());
+    Graph g(n);
+    std::vector<int> row;
+    for (int u = 0; u < n; ++u) {
+        row.clear();
+        for (const auto& e : maps[u]) {
+            row.insert(row.end(), e.second, e.first);
+        }
+        std::sort(row.begin(), row.end());
+        for (int v : row) {
+            g.addEdge(u, v);
+        }
+    }
+    return g;
+}
+
+// Copy the current graph.
+Graph DynamicGraph::toGraph() const {
+    return listsFrom(out);
+}
+
+// Copy the maintained transpose.
+Graph DynamicGraph::getTranspose() const {
+    return listsFrom(in);
+}
+
+// Copy the maintained square; every vertex with a positive count is one
+// edge.
+Graph DynamicGraph::squareGraph() const {
+    Graph g2(numVertices);
+    std::vector<int> row;
+    for (int u = 0; u < numVertices; ++u) {
+        row.clear();
+        for (const auto& e : square[u]) {
+            row.push_back(e.first);
+        }
+        std::sort(row.begin(), row.end());
+        for (int w : row) {
+            g2.addEdge(u, w);
+        }
+    }
+    return g2;
+}
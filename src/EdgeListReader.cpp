@@ -0,0 +1,182 @@
+// EdgeListReader.cpp
+// Implementation of the edge list parser declared in EdgeListReader.h.
+// Uses POSIX open/mmap to read files.
+
+#include "../include/EdgeListReader.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Target number of bytes per parse chunk; small inputs use one chunk.
+static const std::size_t kChunkBytes = 1 << 20;
+
+// Vertex ids equal to this are rejected, so maxVertex + 1 fits an int.
+static const int kMaxId = std::numeric_limits<int>::max();
+
+namespace {
+
+// Edges parsed from one chunk of the input.
+struct ChunkResult {
+    EdgeList edges;
+    int maxVertex = -1;
+    std::size_t errorOffset = static_cast<std::size_t>(-1);
+};
+
+} // namespace
+
+// Return true for the blanks allowed between and around the numbers.
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// If the comment line at p (just past the '#') is a "vertices n" header
+// as written by writeEdgeList, raise maxVertex to n - 1.  Other comments
+// are ignored.
+static void parseHeader(const char* p, const char* end, int& maxVertex) {
+    static const char kKey[] = "vertices";
+    const std::size_t keyLength = sizeof(kKey) - 1;
+    while (p < end && isBlank(*p)) ++p;
+    if (static_cast<std::size_t>(end - p) < keyLength || std::memcmp(p, kKey, keyLength) != 0) {
+        return;
+    }
+    p += keyLength;
+    const char* q = p;
+    while (q < end && isBlank(*q)) ++q;
+    int n = 0;
+    auto r = std::from_chars(q, end, n);
+    if (q == p || r.ec != std::errc() || n <= 0) return;
+    if (n - 1 > maxVertex) maxVertex = n - 1;
+}
+
+// Parse the lines of [begin, end), which starts at a line boundary.
+// base is the start of the whole buffer, used for error offsets.
+static void parseChunk(const char* base, const char* begin, const char* end,
+                       ChunkResult& out) {
+    const char* p = begin;
+    while (p < end) {
+        const char* lineStart = p;
+        while (p < end && isBlank(*p)) ++p;
+        if (p == end) break;
+        if (*p == '\n') {
+            ++p;
+            continue;
+        }
+        if (*p != '#' && *p != '%') {
+            int u = 0;
+            int v = 0;
+            auto r1 = std::from_chars(p, end, u);
+            const char* q = r1.ptr;
+            while (q < end && isBlank(*q)) ++q;
+            auto r2 = std::from_chars(q, end, v);
+            // The largest id must leave room for the vertex count
+            // maxVertex + 1 in an int.
+            if (r1.ec != std::errc() || r2.ec != std::errc() || q == r1.ptr || u < 0 || v < 0 ||
+                u == kMaxId || v == kMaxId) {
+                out.errorOffset = static_cast<std::size_t>(lineStart - base);
+                return;
+            }
+            out.edges.emplace_back(u, v);
+            if (u > out.maxVertex) out.maxVertex = u;
+            if (v > out.maxVertex) out.maxVertex = v;
+            p = r2.ptr;
+        } else if (*p == '#') {
+            parseHeader(p + 1, end, out.maxVertex);
+        }
+        // Skip the rest of the line (comment text or extra columns).
+        const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+        p = nl ? static_cast<const char*>(nl) + 1 : end;
+    }
+}
+
+// Split the buffer into chunks ending at newlines, parse them in
+// parallel and concatenate the per‑chunk edge lists in order.
+bool parseEdgeList(const char* data, std::size_t size, EdgeList& edges, int& maxVertex,
+                   ThreadPool& pool, std::string* error) {
+    std::vector<const char*> bounds;
+    bounds.push_back(data);
+    const char* end = data + size;
+    while (bounds.back() < end) {
+        const char* next = bounds.back() + std::min(kChunkBytes, static_cast<std::size_t>(end - bounds.back()));
+        if (next < end) {
+            const void* nl = std::memchr(next, '\n', static_cast<std::size_t>(end - next));
+            next = nl ? static_cast<const char*>(nl) + 1 : end;
+        }
+        bounds.push_back(next);
+    }
+    std::size_t numChunks = bounds.size() - 1;
+    std::vector<ChunkResult> chunks(numChunks);
+    pool.parallelFor(numChunks, 1, [&](int, std::size_t begin, std::size_t stop) {
+        for (std::size_t c = begin; c < stop; ++c) {
+            parseChunk(data, bounds[c], bounds[c + 1], chunks[c]);
+        }
+    });
+
+    std::vector<std::size_t> start(numChunks + 1, edges.size());
+    maxVertex = -1;
+    for (std::size_t c = 0; c < numChunks; ++c) {
+        if (chunks[c].errorOffset != static_cast<std::size_t>(-1)) {
+            if (error) *error = "malformed line at byte " + std::to_string(chunks[c].errorOffset);
+            return false;
+        }
+        start[c + 1] = start[c] + chunks[c].edges.size();
+        maxVertex = std::max(maxVertex, chunks[c].maxVertex);
+    }
+    edges.resize(start[numChunks]);
+    pool.parallelFor(numChunks, 1, [&](int, std::size_t begin, std::size_t stop) {
+        for (std::size_t c = begin; c < stop; ++c) {
+            std::copy(chunks[c].edges.begin(), chunks[c].edges.end(), edges.begin() + start[c]);
+            EdgeList().swap(chunks[c].edges);
+        }
+    });
+    return true;
+}
+
+// Map the file and parse it.
+bool readEdgeListFile(const std::string& path, EdgeList& edges, int& maxVertex,
+                      ThreadPool& pool, std::string* error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (error) *error = "cannot open " + path;
+        return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        if (error) *error = "cannot stat " + path;
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        maxVertex = -1;
+        return true;
+    }
+    void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        if (error) *error = "cannot map " + path;
+        return false;
+    }
+    ::madvise(mapped, size, MADV_SEQUENTIAL);
+    bool ok = parseEdgeList(static_cast<const char*>(mapped), size, edges, maxVertex, pool, error);
+    ::munmap(mapped, size);
+    return ok;
+}
+
+// Parse the file and hand the edges to the CSR bulk builder.
+bool loadCsrGraph(const std::string& path, CsrGraph& g, ThreadPool& pool,
+                  int numVertices, std::string* error) {
+    EdgeList edges;
+    int maxVertex = -1;
+    if (!readEdgeListFile(path, edges, maxVertex, pool, error)) return false;
+    g = CsrGraph::fromEdges(numVertices > 0 ? numVertices : maxVertex + 1, edges,
+                            EdgeBuildOptions(), &pool);
+    return true;
+}
@@ -0,0 +1,231 @@
+// Generator.cpp
+// Implementation of the random graph generators declared in Generator.h
+
+#include "../include/Generator.h"
+#include "../include/Metrics.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+
+// Number of chunks of kGeneratorChunk edges needed for m edges.
+static std::size_t chunkCount(std::uint64_t m) {
+    return static_cast<std::size_t>((m + kGeneratorChunk - 1) / kGeneratorChunk);
+}
+
+// Fill an edge list with edgeAt(j) for every j in [0, m), one chunk per
+// task.  Every slot is written exactly once, by whichever thread takes
+// its chunk.
+template <typename EdgeAt>
+static EdgeList generateEdges(std::uint64_t m, EdgeAt edgeAt, ThreadPool* pool) {
+    EdgeList edges(static_cast<std::size_t>(m));
+    auto fill = [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            std::uint64_t first = static_cast<std::uint64_t>(c) * kGeneratorChunk;
+            std::uint64_t last = std::min<std::uint64_t>(first + kGeneratorChunk, m);
+            for (std::uint64_t j = first; j < last; ++j) {
+                edges[j] = edgeAt(j);
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(chunkCount(m), 1, fill);
+    } else {
+        fill(0, 0, chunkCount(m));
+    }
+    return edges;
+}
+
+// Stream the edges chunk by chunk into the CSR builder.
+template <typename EdgeAt>
+static CsrGraph streamGraph(int n, std::uint64_t m, EdgeAt edgeAt,
+                            const EdgeBuildOptions& options, ThreadPool* pool) {
+    auto generate = [&](std::size_t c, EdgeList& out) {
+        std::uint64_t first = static_cast<std::uint64_t>(c) * kGeneratorChunk;
+        std::uint64_t last = std::min<std::uint64_t>(first + kGeneratorChunk, m);
+        for (std::uint64_t j = first; j < last; ++j) {
+            out.push_back(edgeAt(j));
+        }
+    };
+    return CsrGraph::fromEdgeChunks(n, chunkCount(m), generate, options, pool, m);
+}
+
+// Number of levels of the R‑MAT recursion: the smallest s with 2^s >= n.
+static int rmatScale(std::uint64_t n) {
+    int scale = 0;
+    while ((std::uint64_t(1) << scale) < n) ++scale;
+    return scale;
+}
+
+RmatParams RmatParams::graph500() {
+    RmatParams params;
+    params.scramble = true;
+    return params;
+}
+
+namespace {
+
+// Edge j of G(n, m).
+struct ErdosRenyiEdge {
+    std::uint64_t seed;
+    std::uint64_t n;
+    bool selfLoops;
+
+    std::pair<int, int> operator()(std::uint64_t j) const {
+        RandomStream rng(seed, j);
+        std::uint64_t u = rng.nextBelow(n);
+        std::uint64_t v;
+        if (selfLoops) {
+            v = rng.nextBelow(n);
+        } else {
+            v = rng.nextBelow(n - 1);
+            if (v >= u) ++v;
+        }
+        return {static_cast<int>(u), static_cast<int>(v)};
+    }
+};
+
+// Seeded permutation of [0, 2^bits): two rounds of an odd multiplier
+// (plus a constant) and an xor‑shift, each a bijection modulo 2^bits.
+// Values at or above n are walked along their cycle until they drop
+// below n, which restricts the permutation to [0, n).
+struct Scrambler {
+    int bits;
+    std::uint64_t n;
+    std::uint64_t mask;
+    std::uint64_t mul1, add1, mul2, add2;
+
+    Scrambler(int bits, std::uint64_t n, std::uint64_t seed) : bits(bits), n(n) {
+        mask = bits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1;
+        RandomStream rng = RandomStream(seed, 0).split(0);
+        mul1 = rng.next() | 1;
+        add1 = rng.next();
+        mul2 = rng.next() | 1;
+        add2 = rng.next();
+    }
+
+    std::uint64_t round(std::uint64_t x) const {
+        int shift = bits / 2 + 1;
+        x = (x * mul1 + add1) & mask;
+        x ^= x >> shift;
+        x = (x * mul2 + add2) & mask;
+        x ^= x >> shift;
+        return x;
+    }
+
+    std::uint64_t operator()(std::uint64_t x) const {
+        do {
+            x = round(x);
+        } while (x >= n);
+        return x;
+    }
+};
+
+// Edge j of R‑MAT.  The quadrant thresholds are fixed point fractions of
+// 2^32, compared with the two 32‑bit halves of every draw.
+struct RmatEdge {
+    std::uint64_t seed;
+    std::uint64_t n;
+    int scale;
+    std::uint64_t ta, tab, tabc;
+    bool scramble;
+    Scrambler permute;
+
+    RmatEdge(int n, const RmatParams& params, std::uint64_t seed)
+        : seed(seed), n(static_cast<std::uint64_t>(n)), scale(rmatScale(this->n)),
+          scramble(params.scramble), permute(scale, this->n, seed) {
+        const double unit = 4294967296.0;
+        ta = static_cast<std::uint64_t>(params.a * unit);
+        tab = static_cast<std::uint64_t>((params.a + params.b) * unit);
+        tabc = static_cast<std::uint64_t>((params.a + params.b + params.c) * unit);
+    }
+
+    std::pair<int, int> operator()(std::uint64_t j) const {
+        RandomStream rng(seed, j);
+        std::uint64_t u, v;
+        do {
+            u = 0;
+            v = 0;
+            for (int level = 0; level < scale; level += 2) {
+                std::uint64_t bits = rng.next();
+                std::uint64_t r = bits & 0xFFFFFFFFULL;
+                u = (u << 1) | (r >= tab);
+                v = (v << 1) | ((r >= ta) ^ (r >= tab) ^ (r >= tabc));
+                if (level + 1 == scale) break;
+                r = bits >> 32;
+                u = (u << 1) | (r >= tab);
+                v = (v << 1) | ((r >= ta) ^ (r >= tab) ^ (r >= tabc));
+            }
+        } while (u >= n || v >= n);
+        if (scramble) {
+            u = permute(u);
+            v = permute(v);
+        }
+        return {static_cast<int>(u), static_cast<int>(v)};
+    }
+};
+
+// Edge j of the Batagelj–Brandes copy model.
+struct BarabasiAlbertEdge {
+    std::uint64_t seed;
+    std::uint64_t k;
+
+    std::pair<int, int> operator()(std::uint64_t j) const {
+        int source = static_cast<int>(j / k);
+        // Follow odd slots back to a draw that lands on a source.
+        std::uint64_t i = j;
+        while (i > 0) {
+            std::uint64_t slot = RandomStream(seed, i).nextBelow(2 * i);
+            if ((slot & 1) == 0) {
+                return {source, static_cast<int>(slot / 2 / k)};
+            }
+            i = slot / 2;
+        }
+        return {source, 0};
+    }
+};
+
+} // namespace
+
+EdgeList erdosRenyiEdges(int n, std::uint64_t m, std::uint64_t seed, bool selfLoops,
+                         ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "erdosRenyiEdges");
+    if (n <= (selfLoops ? 0 : 1)) return EdgeList();
+    return generateEdges(m, ErdosRenyiEdge{seed, static_cast<std::uint64_t>(n), selfLoops}, pool);
+}
+
+CsrGraph erdosRenyiGraph(int n, std::uint64_t m, std::uint64_t seed, bool selfLoops,
+                         const EdgeBuildOptions& options, ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "erdosRenyiGraph");
+    if (n <= (selfLoops ? 0 : 1)) return CsrGraph(n);
+    return streamGraph(n, m, ErdosRenyiEdge{seed, static_cast<std::uint64_t>(n), selfLoops},
+                       options, pool);
+}
+
+EdgeList rmatEdges(int n, std::uint64_t m, const RmatParams& params, std::uint64_t seed,
+                   ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "rmatEdges");
+    if (n <= 0) return EdgeList();
+    return generateEdges(m, RmatEdge(n, params, seed), pool);
+}
+
+CsrGraph rmatGraph(int n, std::uint64_t m, const RmatParams& params, std::uint64_t seed,
+                   const EdgeBuildOptions& options, ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "rmatGraph");
+    if (n <= 0) return CsrGraph(0);
+    return streamGraph(n, m, RmatEdge(n, params, seed), options, pool);
+}
+
+EdgeList barabasiAlbertEdges(int n, int k, std::uint64_t seed, ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "barabasiAlbertEdges");
+    if (n <= 0 || k <= 0) return EdgeList();
+    std::uint64_t m = static_cast<std::uint64_t>(n) * static_cast<std::uint64_t>(k);
+    return generateEdges(m, BarabasiAlbertEdge{seed, static_cast<std::uint64_t>(k)}, pool);
+}
+
+CsrGraph barabasiAlbertGraph(int n, int k, std::uint64_t seed, const EdgeBuildOptions& options,
+                             ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "barabasiAlbertGraph");
+    if (n <= 0 || k <= 0) return CsrGraph(n < 0 ? 0 : n);
+    std::uint64_t m = static_cast<std::uint64_t>(n) * static_cast<std::uint64_t>(k);
+    return streamGraph(n, m, BarabasiAlbertEdge{seed, static_cast<std::uint64_t>(k)}, options,
+                       pool);
+}
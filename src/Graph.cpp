@@ -2,11 +2,39 @@
 // Implementation of the Graph class declared in Graph.h
 
 #include "../include/Graph.h"
+#include "../include/CsrGraph.h"
+#include "../include/GraphKernels.h"
+#include "../include/GraphWorkspace.h"
+#include "../include/Metrics.h"
+#include "../include/RadixSort.h"
+#include "../include/ThreadPool.h"
 #include <algorithm>
+#include <cstdint>
 
 // Construct an empty graph with v vertices and no edges.
 Graph::Graph(int v) : numVertices(v), adj(v) {}
 
+// Build the lists in CSR form, then copy every one into a vector of
+// exactly its size; the copies run in parallel over vertex ranges.
+Graph Graph::fromEdges(int v, const EdgeList& edges, const EdgeBuildOptions& options,
+                       ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "Graph::fromEdges");
+    CsrGraph csr = CsrGraph::fromEdges(v, edges, options, pool);
+    Graph g(csr.size());
+    auto fill = [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t u = begin; u < end; ++u) {
+            NeighbourRange out = csr.neighbours(static_cast<int>(u));
+            g.adj[u].assign(out.begin(), out.end());
+        }
+    };
+    if (pool) {
+        pool->parallelFor(g.numVertices, 1024, fill);
+    } else {
+        fill(0, 0, g.numVertices);
+    }
+    return g;
+}
+
 // Add a directed edge from u to v.
 void Graph::addEdge(int u, int v) {
     if (u < 0 || u >= numVertices || v < 0 || v >= numVertices)
@@ -19,6 +47,13 @@ int Graph::size() const {
     return numVertices;
 }
 
+// Sum the sizes of the lists.
+std::size_t Graph::numEdges() const {
+    std::size_t count = 0;
+    for (const std::vector<int>& list : adj) count += list.size();
+    return count;
+}
+
 // Return a constant reference to the adjacency list.
 const std::vector<std::vector<int>>& Graph::getAdjacencyList() const {
     return adj;
@@ -26,95 +61,250 @@ const std::vector<std::vector<int>>& Graph::getAdjacencyList() const {
 
 // Compute the transpose of the graph by reversing all edges.
 // For each edge (u, v) in the original graph, the transpose contains
-// an edge (v, u).  Complexity: O(V + E).
+// an edge (v, u).  The in‑degrees are counted first, every list is
+// sized once to its final length, and the edges are scattered straight
+// into the lists in source order, so no intermediate arrays are built.
+// Complexity: O(V + E).
 Graph Graph::getTranspose() const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::getTranspose");
+    GraphStorage g = storageOf(*this);
+    std::vector<std::uint64_t> fill = inDegrees(g);
     Graph gT(numVertices);
+    for (int v = 0; v < numVertices; ++v) {
+        LAB11_METRICS_EDGES(metrics, fill[v]);
+        gT.adj[v].resize(fill[v]);
+        fill[v] = 0;
+    }
     for (int u = 0; u < numVertices; ++u) {
-        for (int v : adj[u]) {
-            gT.addEdge(v, u);
-        }
+        g.forEachNeighbour(u, [&](int v) { gT.adj[v][fill[v]++] = u; });
     }
     return gT;
 }
 
 // Compute the square of the graph.  In the square graph G^2, there is
 // an edge (u, w) if there is a path of length one or two from u to w
-// in the original graph.  To avoid duplicate edges, we use a boolean
-// array to mark which vertices have already been added for each source.
+// in the original graph.  Every row is built by the appendSquareRow
+// kernel, which marks the vertices already added for the source and
+// clears only those marks afterwards; the row is collected first and
+// copied into g2 in one piece.
 Graph Graph::squareGraph() const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::squareGraph");
+    GraphStorage g = storageOf(*this);
     Graph g2(numVertices);
-    std::vector<bool> visited(numVertices);
+    std::vector<char> marked(numVertices, 0);
+    std::vector<int> row;
     for (int u = 0; u < numVertices; ++u) {
-        std::fill(visited.begin(), visited.end(), false);
-        // Include all immediate neighbours of u
-        for (int v : adj[u]) {
-            if (v == u) continue; // skip self loops
-            if (!visited[v]) {
-                g2.addEdge(u, v);
-                visited[v] = true;
-            }
-        }
-        // Include all vertices reachable in two steps
-        for (int v : adj[u]) {
-            for (int w : adj[v]) {
-                if (w == u) continue; // avoid self loops
-                if (!visited[w]) {
-                    g2.addEdge(u, w);
-                    visited[w] = true;
-                }
-            }
-        }
+        row.clear();
+        std::uint64_t scanned = appendSquareRow(g, u, marked, row);
+        LAB11_METRICS_EDGES(metrics, scanned);
+        (void)scanned;
+        g2.adj[u].assign(row.begin(), row.end());
     }
     return g2;
 }
 
 // Perform a BFS on the graph starting at vertex start.  Returns a
 // vector containing the vertices in the order they are discovered.
+// addEdge and fromEdges keep every stored vertex in range, so only start
+// is checked and the kernel runs with unchecked access.
 std::vector<int> Graph::BFS(int start) const {
-    std::vector<int> order;
+    if (start < 0 || start >= numVertices) return std::vector<int>();
+    return bfsVisitOrder<UncheckedAccess>(storageOf(*this), start, "Graph::BFS");
+}
+
+// Convert a multigraph (possibly with parallel edges and loops) to a
+// simple undirected graph.  Loops are removed.  Multiple edges
+// between the same pair of vertices are collapsed into a single edge.
+//
+// Every edge (u, v) is written as the key (min << b) | max, where b is
+// the number of bits of a vertex id; loops get the all‑ones key, which
+// no real pair can have and which sorts last.  After sorting and
+// deduplication the keys are ordered by (min, max), so scattering them
+// in order appends to every list first its smaller neighbours and then
+// its larger ones, both ascending: the lists come out sorted.
+Graph Graph::toSimpleUndirected(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::toSimpleUndirected");
+    int bits = bitsFor(numVertices > 0 ? numVertices - 1 : 0);
+    std::uint64_t lowMask = (std::uint64_t(1) << bits) - 1;
+    std::uint64_t loopKey = (std::uint64_t(1) << (2 * bits)) - 1;
+
+    // Position of the first key of every vertex in the flat buffer.
+    std::vector<std::size_t> start(numVertices + 1, 0);
+    for (int u = 0; u < numVertices; ++u) {
+        start[u + 1] = start[u] + adj[u].size();
+    }
+    std::vector<std::uint64_t> keys(start[numVertices]);
+    LAB11_METRICS_EDGES(metrics, keys.size());
+    auto emit = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t u = begin; u < end; ++u) {
+            std::uint64_t* out = keys.data() + start[u];
+            for (int v : adj[u]) {
+                std::uint64_t a = std::min<std::uint64_t>(u, v);
+                std::uint64_t b = std::max<std::uint64_t>(u, v);
+                *out++ = (a == b) ? loopKey : (a << bits) | b;
+            }
+        }
+    };
+    if (pool) {
+        pool->parallelFor(numVertices, 4096,
+                          [&](int, std::size_t begin, std::size_t end) { emit(begin, end); });
+    } else {
+        emit(0, numVertices);
+    }
+    radixSortUnique(keys, 2 * bits, pool);
+    if (!keys.empty() && keys.back() == loopKey) keys.pop_back();
+
+    std::vector<int> degree(numVertices, 0);
+    for (std::uint64_t key : keys) {
+        ++degree[key >> bits];
+        ++degree[key & lowMask];
+    }
+    Graph gSimple(numVertices);
+    for (int u = 0; u < numVertices; ++u) {
+        gSimple.adj[u].reserve(degree[u]);
+    }
+    for (std::uint64_t key : keys) {
+        int a = static_cast<int>(key >> bits);
+        int b = static_cast<int>(key & lowMask);
+        gSimple.adj[a].push_back(b);
+        gSimple.adj[b].push_back(a);
+    }
+    return gSimple;
+}
+
+// Keep the outer vector and every row's buffer; only a change in the
+// number of rows can allocate.
+void Graph::resetFor(int v, GraphWorkspace& ws) {
+    ws.reserve(adj, static_cast<std::size_t>(v));
+    adj.resize(v);
+    for (auto& list : adj) {
+        list.clear();
+    }
+    numVertices = v;
+}
+
+// BFS with stamps for the visited set and the order vector as the queue:
+// every discovered vertex is appended to it and read back in turn.
+const std::vector<int>& Graph::BFS(int start, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::BFS(workspace)");
+    ws.beginCall();
+    std::vector<int>& order = ws.order;
+    order.clear();
     if (start < 0 || start >= numVertices) return order;
-    std::vector<bool> visited(numVertices, false);
-    std::queue<int> q;
-    visited[start] = true;
-    q.push(start);
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-        order.push_back(u);
-        for (int v : adj[u]) {
-            if (v < 0 || v >= numVertices) continue;
-            if (!visited[v]) {
-                visited[v] = true;
-                q.push(v);
+    ws.reserve(order, static_cast<std::size_t>(numVertices));
+    std::uint32_t mark = ws.nextStamp(numVertices);
+    std::uint32_t* visited = ws.stamp.data();
+    visited[start] = mark;
+    order.push_back(start);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        LAB11_METRICS_QUEUE(metrics, head, order.size());
+        LAB11_METRICS_EDGES(metrics, adj[order[head]].size());
+        for (int v : adj[order[head]]) {
+            if (visited[v] != mark) {
+                visited[v] = mark;
+                order.push_back(v);
             }
         }
     }
     return order;
 }
 
-// Convert a multigraph (possibly with parallel edges and loops) to a
-// simple undirected graph.  Loops are removed.  Multiple edges
-// between the same pair of vertices are collapsed into a single edge.
-Graph Graph::toSimpleUndirected() const {
-    // Use a set for each vertex to avoid duplicates.
-    std::vector<std::unordered_set<int>> setAdj(numVertices);
+// Count in‑degrees first so every row of out is reserved exactly once.
+void Graph::getTranspose(Graph& out, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::getTranspose(workspace)");
+    ws.beginCall();
+    out.resetFor(numVertices, ws);
+    ws.reserve(ws.counts, static_cast<std::size_t>(numVertices));
+    ws.counts.assign(numVertices, 0);
+    for (int u = 0; u < numVertices; ++u) {
+        LAB11_METRICS_EDGES(metrics, adj[u].size());
+        for (int v : adj[u]) {
+            ++ws.counts[v];
+        }
+    }
+    for (int v = 0; v < numVertices; ++v) {
+        ws.reserve(out.adj[v], static_cast<std::size_t>(ws.counts[v]));
+    }
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v : adj[u]) {
+            out.adj[v].push_back(u);
+        }
+    }
+}
+
+// Same row construction as squareGraph(), with stamps instead of a
+// boolean array and the row built directly in out.
+void Graph::squareGraph(Graph& out, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::squareGraph(workspace)");
+    ws.beginCall();
+    out.resetFor(numVertices, ws);
     for (int u = 0; u < numVertices; ++u) {
+        std::uint32_t mark = ws.nextStamp(numVertices);
+        std::uint32_t* seen = ws.stamp.data();
+        std::vector<int>& row = out.adj[u];
         for (int v : adj[u]) {
-            if (v < 0 || v >= numVertices) continue;
-            if (u == v) {
-                // Skip loops
-                continue;
+            if (v == u) continue; // skip self loops
+            if (seen[v] != mark) {
+                seen[v] = mark;
+                ws.append(row, v);
+            }
+        }
+        for (int v : adj[u]) {
+            LAB11_METRICS_EDGES(metrics, adj[v].size());
+            for (int w : adj[v]) {
+                if (w == u) continue; // avoid self loops
+                if (seen[w] != mark) {
+                    seen[w] = mark;
+                    ws.append(row, w);
+                }
             }
-            // Insert both directions to make the graph undirected
-            setAdj[u].insert(v);
-            setAdj[v].insert(u);
         }
     }
-    Graph gSimple(numVertices);
+}
+
+// Same key pipeline as toSimpleUndirected(), serial, with every buffer
+// taken from the workspace.
+void Graph::toSimpleUndirected(Graph& out, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, "Graph::toSimpleUndirected(workspace)");
+    ws.beginCall();
+    int bits = bitsFor(numVertices > 0 ? numVertices - 1 : 0);
+    std::uint64_t lowMask = (std::uint64_t(1) << bits) - 1;
+    std::uint64_t loopKey = (std::uint64_t(1) << (2 * bits)) - 1;
+
+    std::size_t total = 0;
     for (int u = 0; u < numVertices; ++u) {
-        for (int v : setAdj[u]) {
-            gSimple.addEdge(u, v);
+        total += adj[u].size();
+    }
+    LAB11_METRICS_EDGES(metrics, total);
+    std::vector<std::uint64_t>& keys = ws.keys;
+    ws.reserve(keys, total);
+    ws.reserve(ws.keyScratch, total);
+    ws.reserve(ws.histogram, kRadixBuckets);
+    keys.clear();
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v : adj[u]) {
+            std::uint64_t a = std::min<std::uint64_t>(u, v);
+            std::uint64_t b = std::max<std::uint64_t>(u, v);
+            keys.push_back((a == b) ? loopKey : (a << bits) | b);
         }
     }
-    return gSimple;
-}
\ No newline at end of file
+    radixSortUnique(keys, 2 * bits, ws.keyScratch, ws.histogram);
+    if (!keys.empty() && keys.back() == loopKey) keys.pop_back();
+
+    ws.reserve(ws.counts, static_cast<std::size_t>(numVertices));
+    ws.counts.assign(numVertices, 0);
+    for (std::uint64_t key : keys) {
+        ++ws.counts[key >> bits];
+        ++ws.counts[key & lowMask];
+    }
+    out.resetFor(numVertices, ws);
+    for (int u = 0; u < numVertices; ++u) {
+        ws.reserve(out.adj[u], static_cast<std::size_t>(ws.counts[u]));
+    }
+    for (std::uint64_t key : keys) {
+        int a = static_cast<int>(key >> bits);
+        int b = static_cast<int>(key & lowMask);
+        out.adj[a].push_back(b);
+        out.adj[b].push_back(a);
+    }
+}
@@ -0,0 +1,250 @@
+// GraphFile.cpp
+// Implementation of the graph file format declared in GraphFile.h.
+// Uses POSIX open/mmap for reading.
+
+#include "../include/GraphFile.h"
+#include "../include/GraphWriter.h"
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char kMagic[8] = {'L', '1', '1', 'G', 'R', 'A', 'P', 'H'};
+static const std::uint32_t kByteOrder = 0x01020304;
+
+// Store msg in *error if the caller asked for it.
+static bool fail(std::string* error, const std::string& msg) {
+    if (error) *error = msg;
+    return false;
+}
+
+// Write the header, the offsets and the targets with three fwrite calls.
+bool writeGraphFile(const std::string& path, const CsrGraph& g, std::string* error) {
+    GraphFileHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kGraphFileVersion;
+    header.byteOrder = kByteOrder;
+    header.numVertices = static_cast<std::uint64_t>(g.size());
+    header.numEdges = g.numEdges();
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return fail(error, "cannot create " + path);
+    const auto& offsets = g.getOffsets();
+    const auto& targets = g.getTargets();
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1 &&
+              std::fwrite(offsets.data(), sizeof(std::uint64_t), offsets.size(), f) == offsets.size() &&
+              std::fwrite(targets.data(), sizeof(int), targets.size(), f) == targets.size();
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) return fail(error, "write error on " + path);
+    return true;
+}
+
+// Seek past the header and the offsets, stream the targets through an
+// OutputBuffer row by row, then go back and write the header and the
+// offsets collected on the way.
+bool writeGraphFile(const std::string& path, int numVertices, const RowSource& rows,
+                    std::string* error) {
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(numVertices) + 1, 0);
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) return fail(error, "cannot create " + path);
+    const long long targetsStart = static_cast<long long>(sizeof(GraphFileHeader) +
+                                                          offsets.size() * sizeof(std::uint64_t));
+    bool ok = ::fseeko(f, static_cast<off_t>(targetsStart), SEEK_SET) == 0;
+    if (ok) {
+        OutputBuffer out(f);
+        std::vector<int> row;
+        for (int u = 0; u < numVertices; ++u) {
+            row.clear();
+            rows(u, row);
+            out.putBytes(row.data(), row.size() * sizeof(int));
+            offsets[u + 1] = offsets[u] + row.size();
+        }
+        ok = out.flush();
+    }
+
+    GraphFileHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kGraphFileVersion;
+    header.byteOrder = kByteOrder;
+    header.numVertices = static_cast<std::uint64_t>(numVertices);
+    header.numEdges = offsets.back();
+    ok = ok && ::fseeko(f, 0, SEEK_SET) == 0 &&
+         std::fwrite(&header, sizeof(header), 1, f) == 1 &&
+         std::fwrite(offsets.data(), sizeof(std::uint64_t), offsets.size(), f) == offsets.size();
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) return fail(error, "write error on " + path);
+    return true;
+}
+
+// Construct a closed graph.
+MappedGraph::MappedGraph() : data(nullptr), length(0) {}
+
+// Unmap on destruction.
+MappedGraph::~MappedGraph() {
+    close();
+}
+
+// Take over the mapping of other.
+MappedGraph::MappedGraph(MappedGraph&& other) noexcept
+    : data(other.data), length(other.length), arrays(other.arrays),
+      lastError(std::move(other.lastError)) {
+    other.data = nullptr;
+    other.length = 0;
+    other.arrays = CsrView();
+}
+
+// Release the current mapping and take over the mapping of other.
+MappedGraph& MappedGraph::operator=(MappedGraph&& other) noexcept {
+    if (this != &other) {
+        close();
+        data = other.data;
+        length = other.length;
+        arrays = other.arrays;
+        lastError = std::move(other.lastError);
+        other.data = nullptr;
+        other.length = 0;
+        other.arrays = CsrView();
+    }
+    return *this;
+}
+
+// Check every offset and target of a mapped file: the offsets must not
+// decrease or pass numEdges and every target must name a vertex.  Returns
+// an empty string if the arrays are consistent.
+static std::string checkArrays(const std::string& path, const GraphFileHeader& header,
+                               const std::uint64_t* offsets, const int* targets) {
+    for (std::uint64_t u = 0; u < header.numVertices; ++u) {
+        if (offsets[u] > offsets[u + 1] || offsets[u + 1] > header.numEdges) {
+            return path + " has inconsistent offsets at vertex " + std::to_string(u);
+        }
+    }
+    const std::uint64_t n = header.numVertices;
+    for (std::uint64_t i = 0; i < header.numEdges; ++i) {
+        if (targets[i] < 0 || static_cast<std::uint64_t>(targets[i]) >= n) {
+            return path + " has an out-of-range target at edge " + std::to_string(i);
+        }
+    }
+    return std::string();
+}
+
+// Map the file read‑only and validate the header against the file size.
+bool MappedGraph::open(const std::string& path, bool verify) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return fail(&lastError, "cannot open " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return fail(&lastError, "cannot stat " + path);
+    }
+    std::size_t fileSize = static_cast<std::size_t>(st.st_size);
+    if (fileSize < sizeof(GraphFileHeader)) {
+        ::close(fd);
+        return fail(&lastError, path + " is too small to be a graph file");
+    }
+    void* mapped = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) return fail(&lastError, "cannot map " + path);
+
+    GraphFileHeader header;
+    std::memcpy(&header, mapped, sizeof(header));
+    std::string problem;
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        problem = path + " is not a graph file";
+    } else if (header.byteOrder != kByteOrder) {
+        problem = path + " was written with a different byte order";
+    } else if (header.version != kGraphFileVersion) {
+        problem = path + " has unsupported version " + std::to_string(header.version);
+    } else if (header.numVertices > static_cast<std::uint64_t>(std::numeric_limits<int>::max())) {
+        problem = path + " has too many vertices";
+    } else {
+        // Bound each array by the bytes that are actually there before
+        // multiplying, so a forged header cannot wrap the size check.
+        std::uint64_t payload = fileSize - sizeof(GraphFileHeader);
+        std::uint64_t offsetCount = header.numVertices + 1;
+        if (offsetCount > payload / sizeof(std::uint64_t)) {
+            problem = path + " is too small for its offsets";
+        } else if (header.numEdges >
+                   (payload - offsetCount * sizeof(std::uint64_t)) / sizeof(int)) {
+            problem = path + " is too small for its targets";
+        } else if (offsetCount * sizeof(std::uint64_t) + header.numEdges * sizeof(int) !=
+                   payload) {
+            problem = path + " has the wrong size";
+        }
+    }
+    const char* bytes = static_cast<const char*>(mapped);
+    const std::uint64_t* offsets =
+        reinterpret_cast<const std::uint64_t*>(bytes + sizeof(GraphFileHeader));
+    const int* targets = reinterpret_cast<const int*>(offsets + header.numVertices + 1);
+    if (problem.empty() &&
+        (offsets[0] != 0 || offsets[header.numVertices] != header.numEdges)) {
+        problem = path + " has inconsistent offsets";
+    }
+    if (problem.empty() && verify) {
+        problem = checkArrays(path, header, offsets, targets);
+    }
+    if (!problem.empty()) {
+        ::munmap(mapped, fileSize);
+        return fail(&lastError, problem);
+    }
+    data = mapped;
+    length = fileSize;
+    arrays = CsrView(static_cast<int>(header.numVertices), offsets, targets);
+    lastError.clear();
+    return true;
+}
+
+// Unmap the file.
+void MappedGraph::close() {
+    if (data) {
+        ::munmap(data, length);
+    }
+    data = nullptr;
+    length = 0;
+    arrays = CsrView();
+}
+
+// Return true if a file is mapped.
+bool MappedGraph::isOpen() const {
+    return data != nullptr;
+}
+
+// Return the reason of the last failed open().
+const std::string& MappedGraph::error() const {
+    return lastError;
+}
+
+// Return the number of vertices.
+int MappedGraph::size() const {
+    return arrays.size();
+}
+
+// Return the number of edges.
+std::size_t MappedGraph::numEdges() const {
+    return arrays.numEdges();
+}
+
+// Return the out‑neighbours of vertex u.
+NeighbourRange MappedGraph::neighbours(int u) const {
+    return arrays.neighbours(u);
+}
+
+// Return a view of the mapped arrays.
+CsrView MappedGraph::view() const {
+    return arrays;
+}
+
+// Copy the mapped arrays into an owning graph.
+CsrGraph MappedGraph::toCsrGraph() const {
+    int n = arrays.size();
+    if (n == 0) return CsrGraph(0);
+    std::vector<std::uint64_t> offsets(arrays.offsets, arrays.offsets + n + 1);
+    std::vector<int> targets(arrays.targets, arrays.targets + arrays.numEdges());
+    return CsrGraph::fromArrays(n, std::move(offsets), std::move(targets));
+}
@@ -1,133 +1,239 @@
 // GraphMatrix.cpp
-// Implementation of GraphMatrix declared in GraphMatrix.h
+// Implementation of DenseGraphMatrix declared in GraphMatrix.h
 
 #include "../include/GraphMatrix.h"
+#include "../include/GraphWorkspace.h"
+#include "../include/MatrixKernels.h"
+#include "../include/Metrics.h"
+#include "../include/SimdKernels.h"
+#include <algorithm>
+#include <limits>
+
+// Name of an algorithm in the metrics registry: the int and the byte
+// matrix are reported separately.
+#define MATRIX_METRIC(method) (sizeof(Cell) == 1 ? "ByteGraphMatrix::" method : "GraphMatrix::" method)
+
+// Number of cells in 64 bytes; rows are padded to a multiple of it.
+template <typename Cell>
+static std::size_t paddedStride(int n) {
+    const std::size_t perLine = 64 / sizeof(Cell);
+    std::size_t cols = static_cast<std::size_t>(n);
+    return (cols + perLine - 1) / perLine * perLine;
+}
 
 // Construct an empty matrix graph with n vertices.  All entries are
 // initialised to 0 (no edges).
-GraphMatrix::GraphMatrix(int n) : n(n), adjMat(n, std::vector<int>(n, 0)) {}
+template <typename Cell>
+DenseGraphMatrix<Cell>::DenseGraphMatrix(int n)
+    : n(n < 0 ? 0 : n),
+      rowStride(paddedStride<Cell>(this->n)),
+      cells(static_cast<std::size_t>(this->n) * rowStride, Cell(0)) {}
 
 // Set an edge from u to v with the given value.  A non‑zero value
-// signifies the presence of an edge.  Bounds are not checked.
-void GraphMatrix::setEdge(int u, int v, int value) {
+// signifies the presence of an edge.  A value that does not fit in Cell
+// (e.g. 256 in a byte matrix) is stored as 1 rather than truncated, so
+// it cannot turn into 0 and delete the edge.
+template <typename Cell>
+void DenseGraphMatrix<Cell>::setEdge(int u, int v, int value) {
     if (u < 0 || u >= n || v < 0 || v >= n) return;
-    adjMat[u][v] = value;
+    if constexpr (sizeof(Cell) < sizeof(int)) {
+        if (value < static_cast<int>(std::numeric_limits<Cell>::min()) ||
+            value > static_cast<int>(std::numeric_limits<Cell>::max())) {
+            value = 1;
+        }
+    }
+    rowData(u)[v] = static_cast<Cell>(value);
 }
 
 // Return the number of vertices.
-int GraphMatrix::size() const {
+template <typename Cell>
+int DenseGraphMatrix<Cell>::size() const {
     return n;
 }
 
-// Return a constant reference to the adjacency matrix.
-const std::vector<std::vector<int>>& GraphMatrix::getMatrix() const {
-    return adjMat;
+// Return a view of the adjacency matrix.
+template <typename Cell>
+MatrixView<Cell> DenseGraphMatrix<Cell>::getMatrix() const {
+    return MatrixView<Cell>{cells.data(), rowStride, n};
+}
+
+// Return a pointer to the first cell of row u.
+template <typename Cell>
+const Cell* DenseGraphMatrix<Cell>::row(int u) const {
+    return cells.data() + static_cast<std::size_t>(u) * rowStride;
+}
+
+template <typename Cell>
+Cell* DenseGraphMatrix<Cell>::rowData(int u) {
+    return cells.data() + static_cast<std::size_t>(u) * rowStride;
+}
+
+// Return the row stride in cells.
+template <typename Cell>
+std::size_t DenseGraphMatrix<Cell>::stride() const {
+    return rowStride;
 }
 
 // Compute the transpose of the graph.  For each edge (u, v) in the
-// original graph, the transposed graph contains (v, u).  Complexity O(V^2).
-GraphMatrix GraphMatrix::getTranspose() const {
-    GraphMatrix gT(n);
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            gT.adjMat[j][i] = adjMat[i][j];
-        }
-    }
+// original graph, the transposed graph contains (v, u).  Both matrices
+// have the same stride, and the padding cells stay zero because only
+// the n x n block is written.  Complexity O(V^2).
+template <typename Cell>
+DenseGraphMatrix<Cell> DenseGraphMatrix<Cell>::getTranspose(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, MATRIX_METRIC("getTranspose"));
+    LAB11_METRICS_EDGES(metrics, static_cast<std::uint64_t>(n) * n);
+    DenseGraphMatrix gT(n);
+    transposeBlocked(cells.data(), rowStride, gT.cells.data(), gT.rowStride,
+                     static_cast<std::size_t>(n), pool);
     return gT;
 }
 
-// Compute the square of the graph.  In the square graph G^2, an edge
-// (i, j) exists if there is a direct edge or a two‑step path from i
-// to j in the original graph.  Complexity O(V^3).
-GraphMatrix GraphMatrix::squareGraph() const {
-    GraphMatrix g2(n);
-    // Copy existing edges to g2
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            if (adjMat[i][j] != 0) {
-                g2.adjMat[i][j] = 1;
-            }
-        }
-    }
-    // Add edges for two‑step paths
-    for (int i = 0; i < n; ++i) {
-        for (int k = 0; k < n; ++k) {
-            if (adjMat[i][k] != 0) {
-                // There is an edge from i to k
-                for (int j = 0; j < n; ++j) {
-                    if (adjMat[k][j] != 0) {
-                        g2.adjMat[i][j] = 1;
-                    }
-                }
-            }
-        }
-    }
+// Compute the square of the graph with a temporary workspace.
+template <typename Cell>
+DenseGraphMatrix<Cell> DenseGraphMatrix<Cell>::squareGraph() const {
+    GraphWorkspace ws;
+    DenseGraphMatrix g2(0);
+    squareGraph(g2, ws);
     return g2;
 }
 
-// Perform BFS starting at 'start'.  Returns the vertices in the order
-// visited.  Uses a queue and scans each row of the adjacency matrix
-// fully when exploring a vertex.  Complexity O(V^2).
-std::vector<int> GraphMatrix::BFS(int start) const {
-    std::vector<int> order;
-    if (start < 0 || start >= n) return order;
-    std::vector<bool> visited(n, false);
-    std::queue<int> q;
-    visited[start] = true;
-    q.push(start);
-    while (!q.empty()) {
-        int u = q.front();
-        q.pop();
-        order.push_back(u);
-        // Explore all vertices v; there is an edge from u to v if
-        // adjMat[u][v] is non‑zero.
-        for (int v = 0; v < n; ++v) {
-            if (adjMat[u][v] != 0 && !visited[v]) {
-                visited[v] = true;
-                q.push(v);
-            }
-        }
-    }
-    return order;
+// Perform BFS with a temporary workspace.
+template <typename Cell>
+std::vector<int> DenseGraphMatrix<Cell>::BFS(int start) const {
+    GraphWorkspace ws;
+    return BFS(start, ws);
 }
 
 // Find a universal sink in the graph.  A vertex s is a universal
 // sink if every other vertex has an edge to s and s has no outgoing
 // edges.  Uses a linear algorithm to find a candidate and then
-// verifies it.  Complexity O(V).
-int GraphMatrix::findUniversalSink() const {
+// verifies it, its row with the vector search and its column with the
+// column kernel.  Complexity O(V).
+template <typename Cell>
+int DenseGraphMatrix<Cell>::findUniversalSink() const {
+    LAB11_METRICS_SCOPE(metrics, MATRIX_METRIC("findUniversalSink"));
+    const std::size_t endByte = static_cast<std::size_t>(n) * sizeof(Cell);
     int i = 0;
-    int j = 0;
-    // Find candidate sink: iterate through the matrix only along
-    // adjMat[i][j].  If there is an edge from i to j, then i cannot
-    // be a sink.  Otherwise, j cannot be a sink.
-    while (i < n && j < n) {
-        if (adjMat[i][j] != 0) {
-            // i has an outgoing edge, so i cannot be a sink
-            ++i;
-        } else {
-            // adjMat[i][j] == 0 => j cannot be sink (since sink must
-            // have incoming edges from all other vertices).  Move to
-            // next column.
-            ++j;
-        }
+    std::size_t j = 0;
+    // Find candidate sink.  If there is an edge from i to j, then i
+    // cannot be a sink; otherwise j cannot be a sink.  A run of zero
+    // cells in row i eliminates a run of columns, so it is skipped with
+    // the vector search before i moves on.
+    while (i < n && j < static_cast<std::size_t>(n)) {
+        std::size_t b = findNonzeroByte(row(i), j * sizeof(Cell), endByte);
+        if (b >= endByte) break;
+        j = b / sizeof(Cell);
+        ++i;
     }
     if (i >= n) {
         return -1; // no candidate found
     }
     int candidate = i;
     // Verify candidate: candidate has no outgoing edges
-    for (int col = 0; col < n; ++col) {
-        if (adjMat[candidate][col] != 0) {
-            return -1;
-        }
+    if (findNonzeroByte(row(candidate), 0, endByte) != endByte) {
+        return -1;
     }
     // Verify candidate: candidate has incoming edges from all other vertices
-    for (int row = 0; row < n; ++row) {
-        if (row == candidate) continue;
-        if (adjMat[row][candidate] == 0) {
-            return -1;
-        }
+    const std::size_t rowBytes = rowStride * sizeof(Cell);
+    const std::size_t column = static_cast<std::size_t>(candidate) * sizeof(Cell);
+    const std::size_t c = static_cast<std::size_t>(candidate);
+    if (findZeroCellInColumn(cells.data(), rowBytes, column, sizeof(Cell), 0, c) != c ||
+        findZeroCellInColumn(cells.data(), rowBytes, column, sizeof(Cell), c + 1,
+                             static_cast<std::size_t>(n)) != static_cast<std::size_t>(n)) {
+        return -1;
     }
     return candidate;
-}
\ No newline at end of file
+}
+
+// Resize the cell buffer to n rows of the padded stride and zero it.
+template <typename Cell>
+void DenseGraphMatrix<Cell>::resetFor(int size, GraphWorkspace& ws) {
+    n = size < 0 ? 0 : size;
+    rowStride = paddedStride<Cell>(n);
+    std::size_t total = static_cast<std::size_t>(n) * rowStride;
+    ws.reserve(cells, total);
+    cells.assign(total, Cell(0));
+}
+
+// Compute the transpose into out.  Complexity O(V^2).
+template <typename Cell>
+void DenseGraphMatrix<Cell>::getTranspose(DenseGraphMatrix& out, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, MATRIX_METRIC("getTranspose(workspace)"));
+    LAB11_METRICS_EDGES(metrics, static_cast<std::uint64_t>(n) * n);
+    ws.beginCall();
+    out.resetFor(n, ws);
+    transposeBlocked(cells.data(), rowStride, out.cells.data(), out.rowStride,
+                     static_cast<std::size_t>(n));
+}
+
+// Compute the square of the graph.  In the square graph G^2, an edge
+// (i, j) exists if there is a direct edge or a two‑step path from i
+// to j in the original graph.  The original is first copied into the
+// workspace with every non‑zero cell set to 1; row i of the result then
+// starts as that copy and is OR'ed with row k of the copy for every
+// non‑zero cell (i, k), found with the vector search.  Complexity O(V^3).
+template <typename Cell>
+void DenseGraphMatrix<Cell>::squareGraph(DenseGraphMatrix& out, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, MATRIX_METRIC("squareGraph"));
+    ws.beginCall();
+    const std::size_t total = cells.size();
+    ws.reserve(ws.bytes2, total * sizeof(Cell));
+    ws.bytes2.resize(total * sizeof(Cell));
+    Cell* unit = reinterpret_cast<Cell*>(ws.bytes2.data());
+    for (std::size_t c = 0; c < total; ++c) {
+        unit[c] = cells[c] != 0 ? Cell(1) : Cell(0);
+    }
+    out.resetFor(n, ws);
+    std::copy(unit, unit + total, out.cells.data());
+    const std::size_t rowBytes = rowStride * sizeof(Cell);
+    const std::size_t endByte = static_cast<std::size_t>(n) * sizeof(Cell);
+    for (int i = 0; i < n; ++i) {
+        const Cell* r = row(i);
+        Cell* dst = out.rowData(i);
+        // There is an edge from i to k for every non‑zero cell k.
+        for (std::size_t b = findNonzeroByte(r, 0, endByte); b < endByte;) {
+            std::size_t k = b / sizeof(Cell);
+            LAB11_METRICS_EDGES(metrics, n);
+            orBytes(dst, unit + k * rowStride, rowBytes);
+            b = findNonzeroByte(r, (k + 1) * sizeof(Cell), endByte);
+        }
+    }
+}
+
+// Perform BFS starting at 'start'.  Returns the vertices in the order
+// visited.  The unvisited set is kept as a row of all‑ones cells that
+// are cleared on visit; exploring u searches for the next cell where
+// both row u and that mask are non‑zero, which yields the unvisited
+// neighbours in increasing order, as a plain scan would.  The order
+// vector doubles as the queue.  Complexity O(V^2).
+template <typename Cell>
+const std::vector<int>& DenseGraphMatrix<Cell>::BFS(int start, GraphWorkspace& ws) const {
+    LAB11_METRICS_SCOPE(metrics, MATRIX_METRIC("BFS"));
+    ws.beginCall();
+    std::vector<int>& order = ws.order;
+    order.clear();
+    if (start < 0 || start >= n) return order;
+    ws.reserve(order, static_cast<std::size_t>(n));
+    ws.reserve(ws.bytes, rowStride * sizeof(Cell));
+    ws.bytes.assign(rowStride * sizeof(Cell), 0);
+    Cell* unvisited = reinterpret_cast<Cell*>(ws.bytes.data());
+    std::fill(unvisited, unvisited + n, static_cast<Cell>(~Cell(0)));
+    const std::size_t endByte = static_cast<std::size_t>(n) * sizeof(Cell);
+    unvisited[start] = 0;
+    order.push_back(start);
+    for (std::size_t head = 0; head < order.size(); ++head) {
+        const Cell* r = row(order[head]);
+        LAB11_METRICS_QUEUE(metrics, head, order.size());
+        LAB11_METRICS_EDGES(metrics, n);
+        for (std::size_t b = findNonzeroAndByte(r, unvisited, 0, endByte); b < endByte;) {
+            std::size_t v = b / sizeof(Cell);
+            unvisited[v] = 0;
+            order.push_back(static_cast<int>(v));
+            b = findNonzeroAndByte(r, unvisited, (v + 1) * sizeof(Cell), endByte);
+        }
+    }
+    return order;
+}
+
+template class DenseGraphMatrix<int>;
+template class DenseGraphMatrix<std::uint8_t>;
@@ -0,0 +1,246 @@
+// GraphViews.cpp
+// Implementation of the lazy graph views declared in GraphViews.h
+
+#include "../include/GraphViews.h"
+#include "../include/GraphKernels.h"
+#include "../include/Metrics.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+#include <cstring>
+
+// Vertices per chunk of the parallel materialization.
+static const std::size_t kViewChunk = 4096;
+
+ViewBase::ViewBase(const CsrView& g) : numVertices(g.size()), csr(g), lists(nullptr) {}
+
+ViewBase::ViewBase(const CsrGraph& g) : ViewBase(g.view()) {}
+
+ViewBase::ViewBase(const Graph& g)
+    : numVertices(g.size()), csr(), lists(&g.getAdjacencyList()) {}
+
+// O(1) for CSR arrays, one pass over the list sizes for a Graph.
+std::uint64_t ViewBase::numEdges() const {
+    if (!lists) return csr.numEdges();
+    std::uint64_t count = 0;
+    for (const std::vector<int>& list : *lists) count += list.size();
+    return count;
+}
+
+// Cache of at most capacityTargets targets.
+RowCache::RowCache(std::size_t capacityTargets) : capacity(capacityTargets) {}
+
+// Move a hit to the front of the list.
+const std::vector<int>* RowCache::find(int u) {
+    auto it = index.find(u);
+    if (it == index.end()) return nullptr;
+    ++counters.hits;
+    entries.splice(entries.begin(), entries, it->second);
+    return &it->second->row;
+}
+
+// Insert at the front, then drop rows from the back while over capacity,
+// never the new one.
+const std::vector<int>& RowCache::insert(int u, std::vector<int> row) {
+    ++counters.misses;
+    counters.targets += row.size();
+    ++counters.rows;
+    entries.push_front(Entry{u, std::move(row)});
+    index[u] = entries.begin();
+    while (counters.targets > capacity && counters.rows > 1) {
+        Entry& last = entries.back();
+        counters.targets -= last.row.size();
+        --counters.rows;
+        ++counters.evictions;
+        index.erase(last.vertex);
+        entries.pop_back();
+    }
+    return entries.front().row;
+}
+
+void RowCache::clear() {
+    entries.clear();
+    index.clear();
+    counters.rows = 0;
+    counters.targets = 0;
+}
+
+static NeighbourRange rangeOf(const std::vector<int>& row) {
+    return NeighbourRange{row.data(), row.data() + row.size()};
+}
+
+// Return the vertices of wanted that are in range and not cached, each
+// once, in the order given.
+static std::vector<int> missingRows(const std::vector<int>& wanted, const RowCache& cache, int n) {
+    std::vector<int> missing;
+    for (int v : wanted) {
+        if (v < 0 || v >= n || cache.contains(v)) continue;
+        if (std::find(missing.begin(), missing.end(), v) != missing.end()) continue;
+        missing.push_back(v);
+    }
+    return missing;
+}
+
+// One pass over all edges (u, w) of base that calls visit(slot, x) for
+// every edge with an end among vertices: visit(slot of w, u) for the
+// in‑edges and, if both directions are asked for, visit(slot of u, w)
+// for the out‑edges.  Loops are skipped in the undirected case.
+template <typename Visit>
+static void scanEdges(const ViewBase& base, const std::vector<int>& vertices, bool undirected,
+                      Visit visit) {
+    const int n = base.size();
+    if (vertices.size() == 1) {
+        const int v = vertices[0];
+        for (int u = 0; u < n; ++u) {
+            for (int w : base.neighbours(u)) {
+                if (undirected && w == u) continue;
+                if (w == v) visit(0, u);
+                if (undirected && u == v) visit(0, w);
+            }
+        }
+        return;
+    }
+    std::vector<int> slot(n, -1);
+    for (std::size_t i = 0; i < vertices.size(); ++i) slot[vertices[i]] = static_cast<int>(i);
+    for (int u = 0; u < n; ++u) {
+        for (int w : base.neighbours(u)) {
+            if (undirected && w == u) continue;
+            if (slot[w] >= 0) visit(slot[w], u);
+            if (undirected && slot[u] >= 0) visit(slot[u], w);
+        }
+    }
+}
+
+TransposeView::TransposeView(const ViewBase& base, std::size_t cacheTargets)
+    : base(base), cache(cacheTargets) {}
+
+NeighbourRange TransposeView::neighbours(int v) {
+    if (const std::vector<int>* row = cache.find(v)) return rangeOf(*row);
+    std::vector<int> row;
+    scanEdges(base, {v}, false, [&](int, int u) { row.push_back(u); });
+    return rangeOf(cache.insert(v, std::move(row)));
+}
+
+void TransposeView::prefetch(const std::vector<int>& vertices) {
+    std::vector<int> missing = missingRows(vertices, cache, base.size());
+    if (missing.empty()) return;
+    std::vector<std::vector<int>> rows(missing.size());
+    scanEdges(base, missing, false, [&](int s, int u) { rows[s].push_back(u); });
+    for (std::size_t i = 0; i < missing.size(); ++i) cache.insert(missing[i], std::move(rows[i]));
+}
+
+// Emit every edge reversed, chunk by chunk in source order: the counting
+// sort of fromEdgeChunks then lists the sources of every target in
+// ascending order, as CsrGraph::getTranspose does.
+CsrGraph TransposeView::materialize(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, "TransposeView::materialize");
+    const int n = base.size();
+    const ViewBase& g = base;
+    std::size_t chunks = (static_cast<std::size_t>(n) + kViewChunk - 1) / kViewChunk;
+    EdgeChunkSource generate = [&](std::size_t c, EdgeList& out) {
+        int first = static_cast<int>(c * kViewChunk);
+        int last = static_cast<int>(std::min<std::size_t>(n, (c + 1) * kViewChunk));
+        for (int u = first; u < last; ++u) {
+            for (int w : g.neighbours(u)) out.emplace_back(w, u);
+        }
+    };
+    return CsrGraph::fromEdgeChunks(n, chunks, generate, EdgeBuildOptions(), pool, g.numEdges());
+}
+
+SquareView::SquareView(const ViewBase& base, std::size_t cacheTargets)
+    : base(base), cache(cacheTargets) {}
+
+NeighbourRange SquareView::neighbours(int u) {
+    if (const std::vector<int>* row = cache.find(u)) return rangeOf(*row);
+    if (marks.empty()) marks.assign(base.size(), 0);
+    std::vector<int> row;
+    appendSquareRow(base, u, marks, row);
+    return rangeOf(cache.insert(u, std::move(row)));
+}
+
+// Compute the rows chunk by chunk into per‑chunk buffers, recording the
+// row lengths; a prefix sum gives the offsets, and the buffers are copied
+// into place, so the targets are allocated exactly once.
+CsrGraph SquareView::materialize(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, "SquareView::materialize");
+    const int n = base.size();
+    std::size_t chunks = (static_cast<std::size_t>(n) + kViewChunk - 1) / kViewChunk;
+    std::vector<std::vector<int>> chunkTargets(chunks);
+    std::vector<std::vector<char>> threadMarks(threadCount(pool));
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(n) + 1, 0);
+    parallelFor(pool, chunks, 1, [&](int t, std::size_t begin, std::size_t end) {
+        std::vector<char>& mark = threadMarks[t];
+        if (mark.empty()) mark.assign(n, 0);
+        for (std::size_t c = begin; c < end; ++c) {
+            std::vector<int>& row = chunkTargets[c];
+            int first = static_cast<int>(c * kViewChunk);
+            int last = static_cast<int>(std::min<std::size_t>(n, (c + 1) * kViewChunk));
+            for (int u = first; u < last; ++u) {
+                std::size_t before = row.size();
+                appendSquareRow(base, u, mark, row);
+                offsets[u + 1] = row.size() - before;
+            }
+        }
+    });
+    for (int u = 0; u < n; ++u) offsets[u + 1] += offsets[u];
+    std::vector<int> targets(offsets[n]);
+    parallelFor(pool, chunks, 1, [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            const std::vector<int>& row = chunkTargets[c];
+            if (row.empty()) continue;
+            std::memcpy(targets.data() + offsets[c * kViewChunk], row.data(),
+                        row.size() * sizeof(int));
+        }
+    });
+    return CsrGraph::fromArrays(n, std::move(offsets), std::move(targets));
+}
+
+UndirectedView::UndirectedView(const ViewBase& base, std::size_t cacheTargets)
+    : base(base), cache(cacheTargets) {}
+
+// Sort the collected ends and drop duplicates.
+static void simplifyRow(std::vector<int>& row) {
+    std::sort(row.begin(), row.end());
+    row.erase(std::unique(row.begin(), row.end()), row.end());
+}
+
+NeighbourRange UndirectedView::neighbours(int u) {
+    if (const std::vector<int>* row = cache.find(u)) return rangeOf(*row);
+    std::vector<int> row;
+    scanEdges(base, {u}, true, [&](int, int w) { row.push_back(w); });
+    simplifyRow(row);
+    return rangeOf(cache.insert(u, std::move(row)));
+}
+
+void UndirectedView::prefetch(const std::vector<int>& vertices) {
+    std::vector<int> missing = missingRows(vertices, cache, base.size());
+    if (missing.empty()) return;
+    std::vector<std::vector<int>> rows(missing.size());
+    scanEdges(base, missing, true, [&](int s, int w) { rows[s].push_back(w); });
+    for (std::size_t i = 0; i < missing.size(); ++i) {
+        simplifyRow(rows[i]);
+        cache.insert(missing[i], std::move(rows[i]));
+    }
+}
+
+// Emit both directions of every edge except loops and let fromEdgeChunks
+// sort and deduplicate the rows.
+CsrGraph UndirectedView::materialize(ThreadPool* pool) const {
+    LAB11_METRICS_SCOPE(metrics, "UndirectedView::materialize");
+    const int n = base.size();
+    const ViewBase& g = base;
+    std::size_t chunks = (static_cast<std::size_t>(n) + kViewChunk - 1) / kViewChunk;
+    EdgeChunkSource generate = [&](std::size_t c, EdgeList& out) {
+        int first = static_cast<int>(c * kViewChunk);
+        int last = static_cast<int>(std::min<std::size_t>(n, (c + 1) * kViewChunk));
+        for (int u = first; u < last; ++u) {
+            for (int w : g.neighbours(u)) {
+                if (w == u) continue;
+                out.emplace_back(u, w);
+                out.emplace_back(w, u);
+            }
+        }
+    };
+    EdgeBuildOptions options;
+    options.removeDuplicates = true;
+    return CsrGraph::fromEdgeChunks(n, chunks, generate, options, pool, 2 * g.numEdges());
+}
@@ -0,0 +1,34 @@
+// GraphWorkspace.cpp
+// Implementation of GraphWorkspace declared in GraphWorkspace.h
+
+#include "../include/GraphWorkspace.h"
+
+// Swap every buffer with an empty one, which frees its memory.
+void GraphWorkspace::release() {
+    std::vector<std::uint32_t>().swap(stamp);
+    std::vector<int>().swap(queue);
+    std::vector<int>().swap(order);
+    std::vector<int>().swap(row);
+    std::vector<int>().swap(counts);
+    std::vector<std::size_t>().swap(offsets);
+    std::vector<std::uint64_t>().swap(keys);
+    std::vector<std::uint64_t>().swap(keyScratch);
+    std::vector<std::size_t>().swap(histogram);
+    decltype(bytes)().swap(bytes);
+    decltype(bytes2)().swap(bytes2);
+    currentStamp = 0;
+}
+
+// Grow the stamp array with zeros (never a valid stamp); on wrap‑around
+// clear it and start again from 1.
+std::uint32_t GraphWorkspace::nextStamp(std::size_t n) {
+    if (stamp.size() < n) {
+        reserve(stamp, n);
+        stamp.resize(n, 0);
+    }
+    if (++currentStamp == 0) {
+        std::fill(stamp.begin(), stamp.end(), 0);
+        currentStamp = 1;
+    }
+    return currentStamp;
+}
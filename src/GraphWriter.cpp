@@ -0,0 +1,232 @@
+// GraphWriter.cpp
+// Implementation of the buffered graph output declared in GraphWriter.h
+
+#include "../include/GraphWriter.h"
+#include "../include/GraphFile.h"
+#include "../include/SquareEngine.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <ostream>
+
+// Buffer output for a C stream.
+OutputBuffer::OutputBuffer(std::FILE* file, std::size_t capacity)
+    : file(file), stream(nullptr), buffer(capacity < 64 ? 64 : capacity), used(0),
+      failed(false) {}
+
+// Buffer output for a C++ stream.
+OutputBuffer::OutputBuffer(std::ostream& stream, std::size_t capacity)
+    : file(nullptr), stream(&stream), buffer(capacity < 64 ? 64 : capacity), used(0),
+      failed(false) {}
+
+// Flush what is left; errors can no longer be reported here.
+OutputBuffer::~OutputBuffer() {
+    flush();
+}
+
+// Append a NUL‑terminated string.
+void OutputBuffer::put(const char* text) {
+    putBytes(text, std::strlen(text));
+}
+
+// Append raw bytes; blocks larger than the free space are split at the
+// buffer boundary.
+void OutputBuffer::putBytes(const void* data, std::size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        if (used == buffer.size()) drain();
+        std::size_t n = std::min(size, buffer.size() - used);
+        std::memcpy(buffer.data() + used, p, n);
+        used += n;
+        p += n;
+        size -= n;
+    }
+}
+
+// Format straight into the buffer; 20 characters hold any long long.
+void OutputBuffer::putInt(long long value) {
+    if (buffer.size() - used < 20) drain();
+    if (value >= 0 && value < 10) {
+        buffer[used++] = static_cast<char>('0' + value);
+        return;
+    }
+    char* first = buffer.data() + used;
+    std::to_chars_result r = std::to_chars(first, buffer.data() + buffer.size(), value);
+    used += static_cast<std::size_t>(r.ptr - first);
+}
+
+// One fwrite or ostream::write per filled buffer.
+void OutputBuffer::drain() {
+    if (used == 0) return;
+    if (!failed) {
+        if (file) {
+            failed = std::fwrite(buffer.data(), 1, used, file) != used;
+        } else {
+            stream->write(buffer.data(), static_cast<std::streamsize>(used));
+            failed = !*stream;
+        }
+    }
+    used = 0;
+}
+
+// Drain and flush the destination itself.
+bool OutputBuffer::flush() {
+    drain();
+    if (!failed) {
+        if (file) {
+            failed = std::fflush(file) != 0;
+        } else {
+            failed = !stream->flush();
+        }
+    }
+    return !failed;
+}
+
+bool OutputBuffer::ok() const {
+    return !failed;
+}
+
+// Write one "u: a, b, c" line.
+static void putListLine(OutputBuffer& out, int u, const int* first, const int* last,
+                        const char* separator) {
+    out.putInt(u);
+    out.put(':');
+    out.put(' ');
+    for (const int* p = first; p != last; ++p) {
+        if (p != first) out.put(separator);
+        out.putInt(*p);
+    }
+    out.put('\n');
+}
+
+// Write one "u v" line per target.
+static void putEdgeLines(OutputBuffer& out, int u, const int* first, const int* last) {
+    for (const int* p = first; p != last; ++p) {
+        out.putInt(u);
+        out.put(' ');
+        out.putInt(*p);
+        out.put('\n');
+    }
+}
+
+static void putEdgeListHeader(OutputBuffer& out, int numVertices) {
+    out.put("# vertices ");
+    out.putInt(numVertices);
+    out.put('\n');
+}
+
+void writeAdjacencyList(OutputBuffer& out, const Graph& g, const char* separator) {
+    LAB11_METRICS_SCOPE(metrics, "writeAdjacencyList");
+    const auto& adj = g.getAdjacencyList();
+    for (int u = 0; u < g.size(); ++u) {
+        putListLine(out, u, adj[u].data(), adj[u].data() + adj[u].size(), separator);
+    }
+}
+
+void writeAdjacencyList(OutputBuffer& out, const CsrView& g, const char* separator) {
+    LAB11_METRICS_SCOPE(metrics, "writeAdjacencyList(csr)");
+    for (int u = 0; u < g.size(); ++u) {
+        NeighbourRange r = g.neighbours(u);
+        putListLine(out, u, r.begin(), r.end(), separator);
+    }
+}
+
+void writeAdjacencyList(OutputBuffer& out, int numVertices, const RowSource& rows,
+                        const char* separator) {
+    LAB11_METRICS_SCOPE(metrics, "writeAdjacencyList(rows)");
+    std::vector<int> row;
+    for (int u = 0; u < numVertices; ++u) {
+        row.clear();
+        rows(u, row);
+        putListLine(out, u, row.data(), row.data() + row.size(), separator);
+    }
+}
+
+template <typename Cell>
+void writeAdjacencyMatrix(OutputBuffer& out, const DenseGraphMatrix<Cell>& g) {
+    LAB11_METRICS_SCOPE(metrics, "writeAdjacencyMatrix");
+    const int n = g.size();
+    for (int i = 0; i < n; ++i) {
+        const Cell* row = g.row(i);
+        for (int j = 0; j < n; ++j) {
+            out.putInt(static_cast<long long>(row[j]));
+            out.put(' ');
+        }
+        out.put('\n');
+    }
+}
+
+template void writeAdjacencyMatrix(OutputBuffer&, const DenseGraphMatrix<int>&);
+template void writeAdjacencyMatrix(OutputBuffer&, const DenseGraphMatrix<std::uint8_t>&);
+
+void writeEdgeList(OutputBuffer& out, const Graph& g) {
+    LAB11_METRICS_SCOPE(metrics, "writeEdgeList");
+    putEdgeListHeader(out, g.size());
+    const auto& adj = g.getAdjacencyList();
+    for (int u = 0; u < g.size(); ++u) {
+        putEdgeLines(out, u, adj[u].data(), adj[u].data() + adj[u].size());
+    }
+}
+
+void writeEdgeList(OutputBuffer& out, const CsrView& g) {
+    LAB11_METRICS_SCOPE(metrics, "writeEdgeList(csr)");
+    putEdgeListHeader(out, g.size());
+    for (int u = 0; u < g.size(); ++u) {
+        NeighbourRange r = g.neighbours(u);
+        putEdgeLines(out, u, r.begin(), r.end());
+    }
+}
+
+void writeEdgeList(OutputBuffer& out, int numVertices, const RowSource& rows) {
+    LAB11_METRICS_SCOPE(metrics, "writeEdgeList(rows)");
+    putEdgeListHeader(out, numVertices);
+    std::vector<int> row;
+    for (int u = 0; u < numVertices; ++u) {
+        row.clear();
+        rows(u, row);
+        putEdgeLines(out, u, row.data(), row.data() + row.size());
+    }
+}
+
+// Run write on a buffer over a new file and close it.
+template <typename Write>
+static bool writeTextFile(const std::string& path, std::string* error, Write write) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        if (error) *error = "cannot create " + path;
+        return false;
+    }
+    bool ok;
+    {
+        OutputBuffer out(f);
+        write(out);
+        ok = out.flush();
+    }
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok && error) *error = "write error on " + path;
+    return ok;
+}
+
+bool writeEdgeListFile(const std::string& path, const Graph& g, std::string* error) {
+    return writeTextFile(path, error, [&](OutputBuffer& out) { writeEdgeList(out, g); });
+}
+
+bool writeEdgeListFile(const std::string& path, int numVertices, const RowSource& rows,
+                       std::string* error) {
+    return writeTextFile(path, error,
+                         [&](OutputBuffer& out) { writeEdgeList(out, numVertices, rows); });
+}
+
+// The transpose is written from CsrGraph::getTranspose, whose lists are
+// in the same order as those of Graph::getTranspose.
+bool writeGraphDump(const std::string& dir, const Graph& g, std::string* error) {
+    CsrGraph csr = CsrGraph::fromGraph(g);
+    CsrGraph transpose = csr.getTranspose();
+    return writeEdgeListFile(dir + "/graph.txt", g, error) &&
+           writeTextFile(dir + "/transpose.txt", error,
+                         [&](OutputBuffer& out) { writeEdgeList(out, transpose.view()); }) &&
+           writeEdgeListFile(dir + "/square.txt", g.size(), squareRows(csr.view()), error) &&
+           writeGraphFile(dir + "/graph.bin", csr, error) &&
+           writeGraphFile(dir + "/square.bin", g.size(), squareRows(csr.view()), error);
+}
@@ -0,0 +1,304 @@
+// Metrics.cpp
+// Implementation of the metrics registry declared in Metrics.h
+
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::atomic<bool> recording(false);
+std::atomic<bool> hardwareRequested(false);
+std::mutex registryMutex;
+std::map<std::string, AlgorithmMetrics>& registry() {
+    static std::map<std::string, AlgorithmMetrics> totals;
+    return totals;
+}
+
+// Bytes allocated by this thread through the replaced operator new.
+thread_local std::uint64_t threadBytes = 0;
+
+std::uint64_t nowNs() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch())
+                                          .count());
+}
+
+// Hardware events of a perf counter group, in read order.
+#ifdef __linux__
+const std::uint64_t kPerfEvents[4] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+#endif
+
+// Open the four counters as one group for the calling thread, user space
+// only, and start them.  On failure every fd is left at ‑1.
+void openPerfGroup(int fds[4]) {
+    for (int i = 0; i < 4; ++i) fds[i] = -1;
+#ifdef __linux__
+    for (int i = 0; i < 4; ++i) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = kPerfEvents[i];
+        attr.disabled = i == 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        long fd = syscall(SYS_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fds[0], 0);
+        if (fd < 0) {
+            for (int j = 0; j < i; ++j) close(fds[j]);
+            for (int j = 0; j < 4; ++j) fds[j] = -1;
+            return;
+        }
+        fds[i] = static_cast<int>(fd);
+    }
+    ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+// Stop the group, read it into counters and close it.
+void closePerfGroup(int fds[4], HardwareCounters& counters) {
+#ifdef __linux__
+    if (fds[0] < 0) return;
+    ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    std::uint64_t values[1 + 4] = {0, 0, 0, 0, 0};
+    if (read(fds[0], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) &&
+        values[0] == 4) {
+        counters.valid = true;
+        counters.cycles = values[1];
+        counters.instructions = values[2];
+        counters.cacheMisses = values[3];
+        counters.branchMisses = values[4];
+    }
+    for (int i = 0; i < 4; ++i) close(fds[i]);
+#else
+    (void)fds;
+    (void)counters;
+#endif
+}
+
+} // namespace
+
+void Metrics::setEnabled(bool on) {
+    recording.store(on, std::memory_order_relaxed);
+}
+
+bool Metrics::enabled() {
+    return recording.load(std::memory_order_relaxed);
+}
+
+void Metrics::setHardwareCounters(bool on) {
+    hardwareRequested.store(on, std::memory_order_relaxed);
+}
+
+void Metrics::reset() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    registry().clear();
+}
+
+std::vector<AlgorithmMetrics> Metrics::snapshot() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::vector<AlgorithmMetrics> result;
+    for (const auto& entry : registry()) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+// One object per algorithm in an "algorithms" array.
+std::string Metrics::toJson() {
+    std::ostringstream out;
+    out << "{\n  \"algorithms\": [";
+    bool first = true;
+    for (const AlgorithmMetrics& m : snapshot()) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "    {\"name\": \"" << m.name << "\", \"calls\": " << m.calls
+            << ", \"total_ms\": " << m.totalMs << ", \"max_ms\": " << m.maxMs
+            << ", \"edges_scanned\": " << m.edgesScanned
+            << ", \"bytes_allocated\": " << m.bytesAllocated << ", \"levels\": " << m.levels
+            << ", \"last_frontier\": [";
+        for (std::size_t i = 0; i < m.lastFrontier.size(); ++i) {
+            out << (i ? ", " : "") << m.lastFrontier[i];
+        }
+        out << "]";
+        if (m.hardware.valid) {
+            out << ", \"cycles\": " << m.hardware.cycles
+                << ", \"instructions\": " << m.hardware.instructions
+                << ", \"cache_misses\": " << m.hardware.cacheMisses
+                << ", \"branch_misses\": " << m.hardware.branchMisses;
+        }
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+// One metric family per quantity, one labelled sample per algorithm.
+std::string Metrics::toPrometheus() {
+    std::vector<AlgorithmMetrics> all = snapshot();
+    std::ostringstream out;
+    auto family = [&](const char* name, const char* type, const char* help, auto value,
+                      bool hardwareOnly) {
+        out << "# HELP " << name << ' ' << help << '\n';
+        out << "# TYPE " << name << ' ' << type << '\n';
+        for (const AlgorithmMetrics& m : all) {
+            if (hardwareOnly && !m.hardware.valid) continue;
+            out << name << "{algorithm=\"" << m.name << "\"} " << value(m) << '\n';
+        }
+    };
+    family("lab11_algorithm_calls_total", "counter", "Number of calls.",
+           [](const AlgorithmMetrics& m) { return m.calls; }, false);
+    family("lab11_algorithm_seconds_total", "counter", "Wall time spent in the algorithm.",
+           [](const AlgorithmMetrics& m) { return m.totalMs / 1000.0; }, false);
+    family("lab11_algorithm_max_seconds", "gauge", "Longest single call.",
+           [](const AlgorithmMetrics& m) { return m.maxMs / 1000.0; }, false);
+    family("lab11_algorithm_edges_scanned_total", "counter", "Adjacency entries scanned.",
+           [](const AlgorithmMetrics& m) { return m.edgesScanned; }, false);
+    family("lab11_algorithm_allocated_bytes_total", "counter",
+           "Bytes allocated by the calling thread.",
+           [](const AlgorithmMetrics& m) { return m.bytesAllocated; }, false);
+    family("lab11_algorithm_levels_total", "counter", "BFS levels processed.",
+           [](const AlgorithmMetrics& m) { return m.levels; }, false);
+    family("lab11_algorithm_cycles_total", "counter", "CPU cycles (perf_event_open).",
+           [](const AlgorithmMetrics& m) { return m.hardware.cycles; }, true);
+    family("lab11_algorithm_instructions_total", "counter", "Instructions retired.",
+           [](const AlgorithmMetrics& m) { return m.hardware.instructions; }, true);
+    family("lab11_algorithm_cache_misses_total", "counter", "Last level cache misses.",
+           [](const AlgorithmMetrics& m) { return m.hardware.cacheMisses; }, true);
+    family("lab11_algorithm_branch_misses_total", "counter", "Mispredicted branches.",
+           [](const AlgorithmMetrics& m) { return m.hardware.branchMisses; }, true);
+    return out.str();
+}
+
+std::uint64_t Metrics::threadAllocatedBytes() {
+    return threadBytes;
+}
+
+// Take the starting values only when recording is on.
+MetricsScope::MetricsScope(const char* name)
+    : name(name), active(Metrics::enabled()), edges(0), startBytes(0), startNs(0),
+      perfFds{-1, -1, -1, -1}, levelEnd(0) {
+    if (!active) return;
+    startBytes = threadBytes;
+    if (hardwareRequested.load(std::memory_order_relaxed)) openPerfGroup(perfFds);
+    startNs = nowNs();
+}
+
+// Add this call to the totals of its algorithm.
+MetricsScope::~MetricsScope() {
+    if (!active) return;
+    double ms = static_cast<double>(nowNs() - startNs) / 1e6;
+    HardwareCounters hw;
+    closePerfGroup(perfFds, hw);
+    std::uint64_t bytes = threadBytes - startBytes;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    AlgorithmMetrics& m = registry()[name];
+    if (m.name.empty()) m.name = name;
+    ++m.calls;
+    m.totalMs += ms;
+    m.maxMs = std::max(m.maxMs, ms);
+    m.edgesScanned += edges;
+    m.bytesAllocated += bytes;
+    if (!frontier.empty()) {
+        m.levels += frontier.size();
+        m.lastFrontier = frontier;
+    }
+    if (hw.valid) {
+        m.hardware.valid = true;
+        m.hardware.cycles += hw.cycles;
+        m.hardware.instructions += hw.instructions;
+        m.hardware.cacheMisses += hw.cacheMisses;
+        m.hardware.branchMisses += hw.branchMisses;
+    }
+}
+
+#ifdef LAB11_METRICS
+// Replacement allocation functions that count the bytes requested by
+// every thread.  The array forms of the standard library forward to
+// these.
+static void* countedAllocate(std::size_t size) {
+    threadBytes += size;
+    if (size == 0) size = 1;
+    for (;;) {
+        if (void* p = std::malloc(size)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+static void* countedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+    threadBytes += size;
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = size == 0 ? align : (size + align - 1) / align * align;
+    for (;;) {
+        if (void* p = std::aligned_alloc(align, rounded)) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new(std::size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocate(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAllocateAligned(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return countedAllocateAligned(size, alignment);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+#endif // LAB11_METRICS
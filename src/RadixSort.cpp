@@ -0,0 +1,103 @@
+// RadixSort.cpp
+// Implementation of the radix sort declared in RadixSort.h
+
+#include "../include/RadixSort.h"
+#include "../include/ThreadPool.h"
+#include <algorithm>
+#include <cstddef>
+
+// Digit width; kRadixBuckets buckets per pass.
+static const int kDigitBits = 11;
+static const std::size_t kBuckets = kRadixBuckets;
+
+// Sort with one histogram and scatter per digit.  The input is split
+// into one fixed block per thread; bucket offsets are assigned in
+// (digit, block) order, which keeps every pass stable.
+void radixSort(std::vector<std::uint64_t>& keys, int keyBits, std::vector<std::uint64_t>& scratch,
+               std::vector<std::size_t>& hist, ThreadPool* pool) {
+    std::size_t count = keys.size();
+    if (count < 2) return;
+    int threads = pool ? pool->size() : 1;
+    // Small inputs are not worth the synchronisation.
+    if (count < (std::size_t(1) << 16)) threads = 1;
+    scratch.resize(count);
+    hist.resize(static_cast<std::size_t>(threads) * kBuckets);
+    std::size_t blockSize = (count + threads - 1) / threads;
+
+    auto forEachBlock = [&](auto&& fn) {
+        auto body = [&](int t) {
+            std::size_t begin = std::min(count, static_cast<std::size_t>(t) * blockSize);
+            std::size_t end = std::min(count, begin + blockSize);
+            fn(t, begin, end);
+        };
+        if (threads == 1) {
+            body(0);
+        } else {
+            pool->run(body);
+        }
+    };
+
+    for (int shift = 0; shift < keyBits; shift += kDigitBits) {
+        const std::uint64_t* src = keys.data();
+        std::uint64_t* dst = scratch.data();
+        std::fill(hist.begin(), hist.end(), std::size_t(0));
+        forEachBlock([&](int t, std::size_t begin, std::size_t end) {
+            std::size_t* h = hist.data() + static_cast<std::size_t>(t) * kBuckets;
+            for (std::size_t i = begin; i < end; ++i) {
+                ++h[(src[i] >> shift) & (kBuckets - 1)];
+            }
+        });
+        // Turn the counts into starting positions; detect a pass in which
+        // every key falls into the same bucket.
+        std::size_t running = 0;
+        bool trivial = false;
+        for (std::size_t d = 0; d < kBuckets; ++d) {
+            std::size_t bucketTotal = 0;
+            for (int t = 0; t < threads; ++t) {
+                std::size_t& h = hist[static_cast<std::size_t>(t) * kBuckets + d];
+                std::size_t c = h;
+                h = running;
+                running += c;
+                bucketTotal += c;
+            }
+            if (bucketTotal == count) trivial = true;
+        }
+        if (trivial) continue;
+        forEachBlock([&](int t, std::size_t begin, std::size_t end) {
+            std::size_t* h = hist.data() + static_cast<std::size_t>(t) * kBuckets;
+            for (std::size_t i = begin; i < end; ++i) {
+                dst[h[(src[i] >> shift) & (kBuckets - 1)]++] = src[i];
+            }
+        });
+        keys.swap(scratch);
+    }
+}
+
+// Sort with temporary scratch memory.
+void radixSort(std::vector<std::uint64_t>& keys, int keyBits, ThreadPool* pool) {
+    std::vector<std::uint64_t> scratch;
+    std::vector<std::size_t> hist;
+    radixSort(keys, keyBits, scratch, hist, pool);
+}
+
+// Sort, then drop adjacent duplicates.
+void radixSortUnique(std::vector<std::uint64_t>& keys, int keyBits, ThreadPool* pool) {
+    radixSort(keys, keyBits, pool);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+void radixSortUnique(std::vector<std::uint64_t>& keys, int keyBits,
+                     std::vector<std::uint64_t>& scratch, std::vector<std::size_t>& hist,
+                     ThreadPool* pool) {
+    radixSort(keys, keyBits, scratch, hist, pool);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+}
+
+// Number of bits needed for maxValue.
+int bitsFor(std::uint64_t maxValue) {
+    int bits = 1;
+    while (bits < 64 && (maxValue >> bits) != 0) {
+        ++bits;
+    }
+    return bits;
+}
@@ -0,0 +1,261 @@
+// Reorder.cpp
+// Implementation of the vertex orderings declared in Reorder.h
+
+#include "../include/Reorder.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+// Invert the order into newId.
+VertexPermutation VertexPermutation::fromOrder(std::vector<int> order) {
+    VertexPermutation p;
+    p.newId.assign(order.size(), -1);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        p.newId[order[i]] = static_cast<int>(i);
+    }
+    p.oldId = std::move(order);
+    return p;
+}
+
+const char* orderingName(VertexOrdering ordering) {
+    switch (ordering) {
+    case VertexOrdering::Identity:
+        return "identity";
+    case VertexOrdering::DegreeDescending:
+        return "degree";
+    case VertexOrdering::Bfs:
+        return "bfs";
+    case VertexOrdering::ReverseCuthillMcKee:
+        return "rcm";
+    }
+    return "unknown";
+}
+
+VertexPermutation identityOrder(int n) {
+    std::vector<int> order(n < 0 ? 0 : n);
+    std::iota(order.begin(), order.end(), 0);
+    return VertexPermutation::fromOrder(std::move(order));
+}
+
+// Out‑degree plus in‑degree of every vertex.
+static std::vector<int> totalDegrees(const CsrView& g) {
+    int n = g.size();
+    std::vector<int> degree(n, 0);
+    for (int u = 0; u < n; ++u) {
+        degree[u] += g.degree(u);
+        for (int v : g.neighbours(u)) {
+            ++degree[v];
+        }
+    }
+    return degree;
+}
+
+// Stable sort by decreasing total degree.
+VertexPermutation degreeOrder(const CsrView& g) {
+    std::vector<int> degree = totalDegrees(g);
+    std::vector<int> order(g.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return degree[a] > degree[b]; });
+    return VertexPermutation::fromOrder(std::move(order));
+}
+
+// One queue shared by all searches; the queue itself is the order.
+VertexPermutation bfsOrder(const CsrView& g, int start) {
+    int n = g.size();
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<bool> visited(n, false);
+    auto search = [&](int root) {
+        std::size_t head = order.size();
+        visited[root] = true;
+        order.push_back(root);
+        for (; head < order.size(); ++head) {
+            for (int v : g.neighbours(order[head])) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            }
+        }
+    };
+    if (start >= 0 && start < n) search(start);
+    for (int v = 0; v < n; ++v) {
+        if (!visited[v]) search(v);
+    }
+    return VertexPermutation::fromOrder(std::move(order));
+}
+
+// Undirected neighbourhoods of g: every edge in both directions (loops
+// and parallel edges are harmless for the searches below).
+static CsrGraph symmetricGraph(const CsrView& g) {
+    int n = g.size();
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(n) + 1, 0);
+    for (int u = 0; u < n; ++u) {
+        offsets[u + 1] += g.degree(u);
+        for (int v : g.neighbours(u)) {
+            ++offsets[v + 1];
+        }
+    }
+    for (int u = 0; u < n; ++u) {
+        offsets[u + 1] += offsets[u];
+    }
+    std::vector<int> targets(offsets[n]);
+    std::vector<std::uint64_t> fill(offsets.begin(), offsets.end() - 1);
+    for (int u = 0; u < n; ++u) {
+        for (int v : g.neighbours(u)) {
+            targets[fill[u]++] = v;
+            targets[fill[v]++] = u;
+        }
+    }
+    return CsrGraph::fromArrays(n, std::move(offsets), std::move(targets));
+}
+
+// Reverse Cuthill–McKee.  Components are started in order of increasing
+// degree of their lowest‑degree unvisited vertex.  For a start vertex r
+// a rooted level structure is built; the lowest‑degree vertex x of its
+// last level is tried next, and x replaces r as long as its level
+// structure is deeper.  Searches are confined to the component through
+// a per‑search stamp, so nothing is cleared between them.
+VertexPermutation reverseCuthillMcKee(const CsrView& g) {
+    int n = g.size();
+    CsrGraph sym = symmetricGraph(g);
+    std::vector<int> byDegree(n);
+    std::iota(byDegree.begin(), byDegree.end(), 0);
+    std::stable_sort(byDegree.begin(), byDegree.end(),
+                     [&](int a, int b) { return sym.degree(a) < sym.degree(b); });
+
+    std::vector<bool> placed(n, false);
+    std::vector<int> stamp(n, 0);
+    int currentStamp = 0;
+    std::vector<int> queue;
+    queue.reserve(n);
+
+    // BFS from root over unplaced vertices; returns the depth of the
+    // level structure and the lowest‑degree vertex of its last level.
+    auto levelStructure = [&](int root, int& lastLevelMin) {
+        ++currentStamp;
+        queue.clear();
+        queue.push_back(root);
+        stamp[root] = currentStamp;
+        int depth = 0;
+        std::size_t levelBegin = 0;
+        while (levelBegin < queue.size()) {
+            std::size_t levelEnd = queue.size();
+            lastLevelMin = queue[levelBegin];
+            for (std::size_t i = levelBegin; i < levelEnd; ++i) {
+                int u = queue[i];
+                if (sym.degree(u) < sym.degree(lastLevelMin)) lastLevelMin = u;
+                for (int v : sym.neighbours(u)) {
+                    if (!placed[v] && stamp[v] != currentStamp) {
+                        stamp[v] = currentStamp;
+                        queue.push_back(v);
+                    }
+                }
+            }
+            levelBegin = levelEnd;
+            if (levelBegin < queue.size()) ++depth;
+        }
+        return depth;
+    };
+
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<int> next;
+    for (int candidate : byDegree) {
+        if (placed[candidate]) continue;
+        // Pseudo‑peripheral root.
+        int root = candidate;
+        int far = root;
+        int depth = levelStructure(root, far);
+        while (far != root) {
+            int farther = far;
+            int farDepth = levelStructure(far, farther);
+            if (farDepth <= depth) break;
+            root = far;
+            depth = farDepth;
+            far = farther;
+        }
+        // Cuthill–McKee from the root.
+        std::size_t head = order.size();
+        placed[root] = true;
+        order.push_back(root);
+        for (; head < order.size(); ++head) {
+            next.clear();
+            for (int v : sym.neighbours(order[head])) {
+                if (!placed[v]) {
+                    placed[v] = true;
+                    next.push_back(v);
+                }
+            }
+            std::sort(next.begin(), next.end(), [&](int a, int b) {
+                return sym.degree(a) != sym.degree(b) ? sym.degree(a) < sym.degree(b) : a < b;
+            });
+            order.insert(order.end(), next.begin(), next.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return VertexPermutation::fromOrder(std::move(order));
+}
+
+VertexPermutation computeOrdering(const CsrView& g, VertexOrdering ordering) {
+    LAB11_METRICS_SCOPE(metrics, "computeOrdering");
+    LAB11_METRICS_EDGES(metrics, g.numEdges());
+    switch (ordering) {
+    case VertexOrdering::DegreeDescending:
+        return degreeOrder(g);
+    case VertexOrdering::Bfs:
+        return bfsOrder(g);
+    case VertexOrdering::ReverseCuthillMcKee:
+        return reverseCuthillMcKee(g);
+    case VertexOrdering::Identity:
+        break;
+    }
+    return identityOrder(g.size());
+}
+
+VertexPermutation computeOrdering(const Graph& g, VertexOrdering ordering) {
+    return computeOrdering(CsrGraph::fromGraph(g), ordering);
+}
+
+// Row newId[u] of the result gets the renamed neighbours of u, sorted.
+CsrGraph relabel(const CsrView& g, const VertexPermutation& p) {
+    LAB11_METRICS_SCOPE(metrics, "relabel");
+    LAB11_METRICS_EDGES(metrics, g.numEdges());
+    int n = g.size();
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(n) + 1, 0);
+    for (int i = 0; i < n; ++i) {
+        offsets[i + 1] = offsets[i] + g.degree(p.oldId[i]);
+    }
+    std::vector<int> targets(offsets[n]);
+    for (int i = 0; i < n; ++i) {
+        int* out = targets.data() + offsets[i];
+        int* last = out;
+        for (int v : g.neighbours(p.oldId[i])) {
+            *last++ = p.newId[v];
+        }
+        std::sort(out, last);
+    }
+    return CsrGraph::fromArrays(n, std::move(offsets), std::move(targets));
+}
+
+Graph relabel(const Graph& g, const VertexPermutation& p) {
+    return relabel(CsrGraph::fromGraph(g), p).toGraph();
+}
+
+std::vector<int> verticesToOriginal(const std::vector<int>& vertices,
+                                    const VertexPermutation& p) {
+    std::vector<int> result(vertices.size());
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+        result[i] = vertices[i] < 0 ? vertices[i] : p.oldId[vertices[i]];
+    }
+    return result;
+}
+
+BfsResult toOriginal(const BfsResult& result, const VertexPermutation& p) {
+    BfsResult original;
+    original.distance = valuesToOriginal(result.distance, p);
+    original.parent = verticesToOriginal(valuesToOriginal(result.parent, p), p);
+    return original;
+}
@@ -0,0 +1,492 @@
+// Scc.cpp
+// Implementation of the strongly connected component algorithms
+// declared in Scc.h
+
+#include "../include/Scc.h"
+#include "../include/Generator.h"
+#include "../include/GraphKernels.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+// One frame of an explicit depth‑first search: the vertex and the part
+// of its neighbour list still to be scanned.
+struct DfsFrame {
+    int v;
+    const int* next;
+    const int* end;
+};
+
+} // namespace
+
+// Kosaraju, pass one: append the vertices of g to order as their
+// depth‑first searches complete.
+template <typename Storage>
+static void finishOrder(int n, const Storage& adj, std::vector<int>& order) {
+    std::vector<char> seen(n, 0);
+    std::vector<DfsFrame> frames;
+    order.reserve(n);
+    for (int s = 0; s < n; ++s) {
+        if (seen[s]) continue;
+        seen[s] = 1;
+        NeighbourRange r = adj.neighbours(s);
+        frames.push_back(DfsFrame{s, r.begin(), r.end()});
+        while (!frames.empty()) {
+            DfsFrame& f = frames.back();
+            if (f.next == f.end) {
+                order.push_back(f.v);
+                frames.pop_back();
+                continue;
+            }
+            int w = *f.next++;
+            if (seen[w]) continue;
+            seen[w] = 1;
+            NeighbourRange rw = adj.neighbours(w);
+            frames.push_back(DfsFrame{w, rw.begin(), rw.end()});
+        }
+    }
+}
+
+// Kosaraju, pass two: search the transpose from the vertices in reverse
+// finishing order; every search collects exactly one component.
+template <typename Storage>
+static SccResult collectComponents(int n, const Storage& adjT, const std::vector<int>& order) {
+    SccResult result;
+    result.component.assign(n, -1);
+    std::vector<int> stack;
+    for (int i = n - 1; i >= 0; --i) {
+        int s = order[i];
+        if (result.component[s] != -1) continue;
+        int c = result.count++;
+        result.component[s] = c;
+        stack.push_back(s);
+        while (!stack.empty()) {
+            int x = stack.back();
+            stack.pop_back();
+            for (int w : adjT.neighbours(x)) {
+                if (result.component[w] != -1) continue;
+                result.component[w] = c;
+                stack.push_back(w);
+            }
+        }
+    }
+    return result;
+}
+
+// Compute the strongly connected components with Kosaraju's algorithm.
+SccResult kosarajuSCC(const CsrView& g, const CsrView& gT) {
+    LAB11_METRICS_SCOPE(metrics, "kosarajuSCC");
+    LAB11_METRICS_EDGES(metrics, g.numEdges() + gT.numEdges());
+    std::vector<int> order;
+    finishOrder(g.size(), storageOf(g), order);
+    return collectComponents(g.size(), storageOf(gT), order);
+}
+
+// Kosaraju on adjacency lists, with the transpose built by Graph.
+SccResult kosarajuSCC(const Graph& g) {
+    LAB11_METRICS_SCOPE(metrics, "kosarajuSCC(list)");
+    std::vector<int> order;
+    finishOrder(g.size(), storageOf(g), order);
+    Graph gT = g.getTranspose();
+    return collectComponents(g.size(), storageOf(gT), order);
+}
+
+// Tarjan's algorithm.  A vertex that has been visited but not yet
+// assigned is exactly a vertex on the component stack, so no separate
+// on‑stack flag is kept.  Components pop out in reverse topological
+// order and are renumbered at the end.
+template <typename Storage>
+static SccResult tarjan(int n, const Storage& adj) {
+    SccResult result;
+    result.component.assign(n, -1);
+    std::vector<int> index(n, -1);
+    std::vector<int> low(n);
+    std::vector<int> stack;
+    std::vector<DfsFrame> frames;
+    int counter = 0;
+    auto visit = [&](int v) {
+        index[v] = low[v] = counter++;
+        stack.push_back(v);
+        NeighbourRange r = adj.neighbours(v);
+        frames.push_back(DfsFrame{v, r.begin(), r.end()});
+    };
+    for (int s = 0; s < n; ++s) {
+        if (index[s] != -1) continue;
+        visit(s);
+        while (!frames.empty()) {
+            DfsFrame& f = frames.back();
+            if (f.next != f.end) {
+                int v = f.v;
+                int w = *f.next++;
+                if (index[w] == -1) {
+                    visit(w);
+                } else if (result.component[w] == -1) {
+                    low[v] = std::min(low[v], index[w]);
+                }
+                continue;
+            }
+            int v = f.v;
+            frames.pop_back();
+            if (!frames.empty()) {
+                int parent = frames.back().v;
+                low[parent] = std::min(low[parent], low[v]);
+            }
+            if (low[v] != index[v]) continue;
+            int c = result.count++;
+            int w;
+            do {
+                w = stack.back();
+                stack.pop_back();
+                result.component[w] = c;
+            } while (w != v);
+        }
+    }
+    for (int& c : result.component) {
+        c = result.count - 1 - c;
+    }
+    return result;
+}
+
+SccResult tarjanSCC(const CsrView& g) {
+    LAB11_METRICS_SCOPE(metrics, "tarjanSCC");
+    LAB11_METRICS_EDGES(metrics, g.numEdges());
+    return tarjan(g.size(), storageOf(g));
+}
+
+SccResult tarjanSCC(const Graph& g) {
+    LAB11_METRICS_SCOPE(metrics, "tarjanSCC(list)");
+    return tarjan(g.size(), storageOf(g));
+}
+
+// Frontiers and work lists at most this long are handled on the calling
+// thread; above it they are split into chunks of this many entries.
+static const std::size_t kSccGrain = 1024;
+
+// Run body(t, begin, end) over [0, count), on the pool if count exceeds
+// grain and as one call on the calling thread otherwise.
+template <typename Body>
+static void forRange(ThreadPool& pool, std::size_t count, std::size_t grain, Body body) {
+    if (count <= grain) {
+        if (count > 0) body(0, 0, count);
+    } else {
+        pool.parallelFor(count, grain, body);
+    }
+}
+
+namespace {
+
+// Shared state of parallelSCC.  label[v] is ‑1 while v is unassigned and
+// the representative vertex of its component afterwards.
+struct ParallelScc {
+    const CsrView& g;
+    const CsrView& gT;
+    ThreadPool& pool;
+    std::unique_ptr<std::atomic<int>[]> label;
+    std::unique_ptr<std::atomic<int>[]> inDegree;
+    std::unique_ptr<std::atomic<int>[]> outDegree;
+    std::unique_ptr<std::atomic<int>[]> colour;
+    std::unique_ptr<std::atomic<std::uint8_t>[]> flag;
+    std::vector<std::vector<int>> local;
+    std::vector<int> active; // the unassigned vertices
+
+    ParallelScc(const CsrView& g, const CsrView& gT, ThreadPool& pool)
+        : g(g), gT(gT), pool(pool), local(pool.size()) {
+        std::size_t n = static_cast<std::size_t>(g.size());
+        label.reset(new std::atomic<int>[n]);
+        inDegree.reset(new std::atomic<int>[n]);
+        outDegree.reset(new std::atomic<int>[n]);
+        colour.reset(new std::atomic<int>[n]);
+        flag.reset(new std::atomic<std::uint8_t>[n]);
+        active.resize(n);
+        for (std::size_t v = 0; v < n; ++v) {
+            label[v].store(-1, std::memory_order_relaxed);
+            colour[v].store(-1, std::memory_order_relaxed);
+            flag[v].store(0, std::memory_order_relaxed);
+            active[v] = static_cast<int>(v);
+        }
+    }
+
+    bool unassigned(int v) const { return label[v].load(std::memory_order_relaxed) == -1; }
+    bool claim(int v, int representative) {
+        int expected = -1;
+        return label[v].compare_exchange_strong(expected, representative,
+                                                std::memory_order_relaxed);
+    }
+
+    // Expand frontier level by level until it is empty; expand(v, out)
+    // appends the vertices it newly reaches from v to out.
+    template <typename Expand>
+    void traverse(std::vector<int>& frontier, Expand expand) {
+        std::vector<int> next;
+        while (!frontier.empty()) {
+            for (auto& list : local) list.clear();
+            forRange(pool, frontier.size(), kSccGrain, [&](int t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) expand(frontier[i], local[t]);
+            });
+            next.clear();
+            for (const auto& list : local) next.insert(next.end(), list.begin(), list.end());
+            frontier.swap(next);
+        }
+    }
+
+    // Drop the vertices assigned since the last call from active.
+    void dropAssigned() {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](int v) { return !unassigned(v); }),
+                     active.end());
+    }
+
+    void trim();
+    void forwardBackward();
+    void colourRemaining();
+};
+
+// Count the in‑ and out‑edges of every active vertex that stay inside
+// the active set, then peel off vertices whose count drops to zero.  The
+// counts are taken before anything is removed, so every decrement
+// matches an edge that was counted.
+void ParallelScc::trim() {
+    forRange(pool, active.size(), kSccGrain, [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            int v = active[i];
+            int out = 0;
+            int in = 0;
+            for (int w : g.neighbours(v)) out += unassigned(w);
+            for (int w : gT.neighbours(v)) in += unassigned(w);
+            outDegree[v].store(out, std::memory_order_relaxed);
+            inDegree[v].store(in, std::memory_order_relaxed);
+        }
+    });
+    for (auto& list : local) list.clear();
+    forRange(pool, active.size(), kSccGrain, [&](int t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            int v = active[i];
+            if ((outDegree[v].load(std::memory_order_relaxed) == 0 ||
+                 inDegree[v].load(std::memory_order_relaxed) == 0) && claim(v, v)) {
+                local[t].push_back(v);
+            }
+        }
+    });
+    std::vector<int> frontier;
+    for (const auto& list : local) frontier.insert(frontier.end(), list.begin(), list.end());
+    traverse(frontier, [&](int v, std::vector<int>& out) {
+        for (int w : g.neighbours(v)) {
+            if (unassigned(w) && inDegree[w].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                claim(w, w)) {
+                out.push_back(w);
+            }
+        }
+        for (int w : gT.neighbours(v)) {
+            if (unassigned(w) && outDegree[w].fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                claim(w, w)) {
+                out.push_back(w);
+            }
+        }
+    });
+    dropAssigned();
+}
+
+// Assign the component of the active vertex with the largest product of
+// in‑ and out‑degree (ties to the smaller ID): the intersection of its
+// forward and backward reach within the active set.
+void ParallelScc::forwardBackward() {
+    if (active.empty()) return;
+    std::vector<std::pair<long long, int>> best(local.size(), std::make_pair(-1LL, -1));
+    forRange(pool, active.size(), kSccGrain, [&](int t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            int v = active[i];
+            flag[v].store(0, std::memory_order_relaxed);
+            long long score = static_cast<long long>(g.degree(v)) * gT.degree(v);
+            if (score > best[t].first || (score == best[t].first && v < best[t].second)) {
+                best[t] = std::make_pair(score, v);
+            }
+        }
+    });
+    int pivot = -1;
+    long long pivotScore = -1;
+    for (const auto& b : best) {
+        if (b.second == -1) continue;
+        if (b.first > pivotScore || (b.first == pivotScore && b.second < pivot)) {
+            pivotScore = b.first;
+            pivot = b.second;
+        }
+    }
+    // Bit 1: reached forward, bit 2: reached backward.
+    auto search = [&](const CsrView& graph, std::uint8_t bit) {
+        flag[pivot].fetch_or(bit, std::memory_order_relaxed);
+        std::vector<int> frontier(1, pivot);
+        traverse(frontier, [&](int v, std::vector<int>& out) {
+            for (int w : graph.neighbours(v)) {
+                if (!unassigned(w) || (flag[w].load(std::memory_order_relaxed) & bit)) continue;
+                if (flag[w].fetch_or(bit, std::memory_order_relaxed) & bit) continue;
+                out.push_back(w);
+            }
+        });
+    };
+    search(g, 1);
+    search(gT, 2);
+    forRange(pool, active.size(), kSccGrain, [&](int, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            int v = active[i];
+            if (flag[v].load(std::memory_order_relaxed) == 3) {
+                label[v].store(pivot, std::memory_order_relaxed);
+            }
+        }
+    });
+    dropAssigned();
+}
+
+// Orzan's colouring, repeated until every vertex is assigned.  Colours
+// only grow in priority, so the forward propagation reaches the same
+// fixed point however the updates interleave.  flag marks a vertex as
+// queued for the next level; it is cleared before the colour is read and
+// set after a colour is raised, both sequentially consistent, so a raise
+// that finds the flag still set is seen by the pending expansion.
+void ParallelScc::colourRemaining() {
+    auto priority = [](int v) { return mix64(static_cast<std::uint64_t>(v)); };
+    auto higher = [&](int a, int b) {
+        std::uint64_t pa = priority(a);
+        std::uint64_t pb = priority(b);
+        return pa > pb || (pa == pb && a > b);
+    };
+    std::vector<int> frontier;
+    std::vector<int> roots;
+    while (!active.empty()) {
+        forRange(pool, active.size(), kSccGrain, [&](int, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                int v = active[i];
+                colour[v].store(v, std::memory_order_relaxed);
+                flag[v].store(0, std::memory_order_relaxed);
+            }
+        });
+        frontier = active;
+        traverse(frontier, [&](int v, std::vector<int>& out) {
+            flag[v].store(0);
+            int c = colour[v].load();
+            for (int w : g.neighbours(v)) {
+                if (!unassigned(w)) continue;
+                int current = colour[w].load(std::memory_order_relaxed);
+                bool raised = false;
+                while (higher(c, current)) {
+                    if (colour[w].compare_exchange_weak(current, c)) {
+                        raised = true;
+                        break;
+                    }
+                }
+                if (raised && flag[w].exchange(1) == 0) {
+                    out.push_back(w);
+                }
+            }
+        });
+        // A root kept its own colour; its component is the part of its
+        // colour class that reaches it.  Colour classes are disjoint, so
+        // the backward searches never touch the same vertex.
+        roots.clear();
+        for (int v : active) {
+            if (colour[v].load(std::memory_order_relaxed) == v) roots.push_back(v);
+        }
+        forRange(pool, roots.size(), 16, [&](int t, std::size_t begin, std::size_t end) {
+            std::vector<int>& stack = local[t];
+            for (std::size_t i = begin; i < end; ++i) {
+                int r = roots[i];
+                label[r].store(r, std::memory_order_relaxed);
+                stack.assign(1, r);
+                while (!stack.empty()) {
+                    int x = stack.back();
+                    stack.pop_back();
+                    for (int w : gT.neighbours(x)) {
+                        if (colour[w].load(std::memory_order_relaxed) != r || !unassigned(w)) {
+                            continue;
+                        }
+                        label[w].store(r, std::memory_order_relaxed);
+                        stack.push_back(w);
+                    }
+                }
+            }
+        });
+        dropAssigned();
+    }
+}
+
+} // namespace
+
+// Compute the strongly connected components in parallel: trim,
+// forward‑backward from one pivot, trim again, then colouring.
+SccResult parallelSCC(const CsrView& g, const CsrView& gT, ThreadPool& pool) {
+    LAB11_METRICS_SCOPE(metrics, "parallelSCC");
+    int n = g.size();
+    ParallelScc state(g, gT, pool);
+    state.trim();
+    state.forwardBackward();
+    state.trim();
+    state.colourRemaining();
+    // Number the representatives in order of their smallest vertex.  The
+    // representative r of a component is one of its vertices, so
+    // component[r] is set when the component is first seen.
+    SccResult result;
+    result.component.assign(n, -1);
+    for (int v = 0; v < n; ++v) {
+        int r = state.label[v].load(std::memory_order_relaxed);
+        if (result.component[r] == -1) result.component[r] = result.count++;
+        result.component[v] = result.component[r];
+    }
+    return result;
+}
+
+// Compare two partitions through a mapping of IDs in each direction.
+bool sameComponents(const SccResult& a, const SccResult& b) {
+    if (a.count != b.count || a.component.size() != b.component.size()) return false;
+    std::vector<int> aToB(a.count, -1);
+    std::vector<int> bToA(b.count, -1);
+    for (std::size_t v = 0; v < a.component.size(); ++v) {
+        int ca = a.component[v];
+        int cb = b.component[v];
+        if (aToB[ca] == -1 && bToA[cb] == -1) {
+            aToB[ca] = cb;
+            bToA[cb] = ca;
+        } else if (aToB[ca] != cb || bToA[cb] != ca) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Vertices per chunk streamed into the condensation builder.
+static const std::size_t kCondensationChunk = 4096;
+
+// Build the condensation from the inter‑component edges of every chunk
+// of source vertices; there are at most edges of them.
+template <typename Storage>
+static CsrGraph condense(int n, const Storage& adj, std::uint64_t edges, const SccResult& scc,
+                         ThreadPool* pool) {
+    const int* component = scc.component.data();
+    std::size_t chunks = (static_cast<std::size_t>(n) + kCondensationChunk - 1) / kCondensationChunk;
+    auto generate = [&](std::size_t c, EdgeList& out) {
+        int first = static_cast<int>(c * kCondensationChunk);
+        int last = static_cast<int>(std::min(static_cast<std::size_t>(n), (c + 1) * kCondensationChunk));
+        for (int u = first; u < last; ++u) {
+            int cu = component[u];
+            for (int w : adj.neighbours(u)) {
+                if (component[w] != cu) out.emplace_back(cu, component[w]);
+            }
+        }
+    };
+    EdgeBuildOptions options;
+    options.removeDuplicates = true;
+    return CsrGraph::fromEdgeChunks(scc.count, chunks, generate, options, pool, edges);
+}
+
+CsrGraph condensation(const CsrView& g, const SccResult& scc, ThreadPool* pool) {
+    LAB11_METRICS_SCOPE(metrics, "condensation");
+    LAB11_METRICS_EDGES(metrics, 2 * g.numEdges());
+    return condense(g.size(), storageOf(g), g.numEdges(), scc, pool);
+}
+
+Graph condensation(const Graph& g, const SccResult& scc) {
+    LAB11_METRICS_SCOPE(metrics, "condensation(list)");
+    return condense(g.size(), storageOf(g), 0, scc, nullptr).toGraph();
+}
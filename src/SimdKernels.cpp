@@ -0,0 +1,349 @@
+// SimdKernels.cpp
+// Implementation of the row kernels declared in SimdKernels.h
+
+#include "../include/SimdKernels.h"
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LAB11_X86 1
+#endif
+
+#if defined(LAB11_X86) && (defined(__x86_64__) || defined(__SSE2__))
+#define LAB11_SSE2 1
+#endif
+
+namespace {
+
+typedef void (*OrFn)(std::uint8_t*, const std::uint8_t*, std::size_t);
+typedef std::size_t (*FindFn)(const std::uint8_t*, std::size_t, std::size_t);
+typedef std::size_t (*FindAndFn)(const std::uint8_t*, const std::uint8_t*, std::size_t,
+                                 std::size_t);
+typedef std::size_t (*CountFn)(const std::uint8_t*, std::size_t, std::size_t);
+typedef void (*AddFn)(int*, const std::uint8_t*, std::size_t, std::size_t);
+typedef std::size_t (*ColumnFn)(const std::uint8_t*, std::size_t, std::size_t, std::size_t,
+                                std::size_t, std::size_t);
+
+// ---------------------------------------------------------------------
+// Scalar versions; also used for the tails of the vector versions.
+
+void orScalar(std::uint8_t* dst, const std::uint8_t* src, std::size_t bytes) {
+    for (std::size_t i = 0; i < bytes; ++i) dst[i] |= src[i];
+}
+
+std::size_t findScalar(const std::uint8_t* p, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        if (p[i] != 0) return i;
+    }
+    return end;
+}
+
+std::size_t findAndScalar(const std::uint8_t* a, const std::uint8_t* b, std::size_t begin,
+                          std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        if ((a[i] & b[i]) != 0) return i;
+    }
+    return end;
+}
+
+inline bool cellNonzero(const std::uint8_t* cell, std::size_t cellBytes) {
+    std::uint8_t any = 0;
+    for (std::size_t b = 0; b < cellBytes; ++b) any |= cell[b];
+    return any != 0;
+}
+
+std::size_t countScalar(const std::uint8_t* p, std::size_t cells, std::size_t cellBytes) {
+    std::size_t count = 0;
+    for (std::size_t j = 0; j < cells; ++j) count += cellNonzero(p + j * cellBytes, cellBytes);
+    return count;
+}
+
+void addScalar(int* counts, const std::uint8_t* row, std::size_t cells, std::size_t cellBytes) {
+    for (std::size_t j = 0; j < cells; ++j) counts[j] += cellNonzero(row + j * cellBytes, cellBytes);
+}
+
+std::size_t columnScalar(const std::uint8_t* base, std::size_t strideBytes,
+                         std::size_t byteOffset, std::size_t cellBytes, std::size_t rowBegin,
+                         std::size_t rowEnd) {
+    for (std::size_t r = rowBegin; r < rowEnd; ++r) {
+        if (!cellNonzero(base + r * strideBytes + byteOffset, cellBytes)) return r;
+    }
+    return rowEnd;
+}
+
+#ifdef LAB11_SSE2
+// ---------------------------------------------------------------------
+// SSE2: 16 bytes per step.  A block with a non‑zero byte is located
+// with a compare against zero and a movemask.
+
+void orSse2(std::uint8_t* dst, const std::uint8_t* src, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(a, b));
+    }
+    orScalar(dst + i, src + i, bytes - i);
+}
+
+// Bit k of the result is set if byte k of v is non‑zero.
+inline unsigned nonzeroMask16(__m128i v) {
+    __m128i zero = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+    return ~static_cast<unsigned>(_mm_movemask_epi8(zero)) & 0xFFFFu;
+}
+
+std::size_t findSse2(const std::uint8_t* p, std::size_t begin, std::size_t end) {
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        unsigned m = nonzeroMask16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)));
+        if (m != 0) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return findScalar(p, i, end);
+}
+
+std::size_t findAndSse2(const std::uint8_t* a, const std::uint8_t* b, std::size_t begin,
+                        std::size_t end) {
+    std::size_t i = begin;
+    for (; i + 16 <= end; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        unsigned m = nonzeroMask16(_mm_and_si128(x, y));
+        if (m != 0) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return findAndScalar(a, b, i, end);
+}
+
+// Bit k of the result is set if byte k of v belongs to a zero cell.
+inline unsigned zeroCellMask16(__m128i v, std::size_t cellBytes) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i eq = cellBytes == 4 ? _mm_cmpeq_epi32(v, zero)
+                 : cellBytes == 2 ? _mm_cmpeq_epi16(v, zero)
+                                  : _mm_cmpeq_epi8(v, zero);
+    return static_cast<unsigned>(_mm_movemask_epi8(eq));
+}
+
+std::size_t countSse2(const std::uint8_t* p, std::size_t cells, std::size_t cellBytes) {
+    const std::size_t bytes = cells * cellBytes;
+    std::size_t nonzeroBytes = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        unsigned zero = zeroCellMask16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)),
+                                       cellBytes);
+        nonzeroBytes += 16 - static_cast<std::size_t>(__builtin_popcount(zero));
+    }
+    return nonzeroBytes / cellBytes + countScalar(p + i, (bytes - i) / cellBytes, cellBytes);
+}
+
+// Four int counters per step for 4‑byte cells, sixteen for bytes (the
+// 0 / ‑1 compare results widened to 32 bits); other widths are scalar.
+void addSse2(int* counts, const std::uint8_t* row, std::size_t cells, std::size_t cellBytes) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi32(1);
+    std::size_t j = 0;
+    if (cellBytes == 4) {
+        for (; j + 4 <= cells; j += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + j * 4));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(counts + j));
+            c = _mm_add_epi32(c, _mm_add_epi32(one, _mm_cmpeq_epi32(v, zero)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(counts + j), c);
+        }
+    } else if (cellBytes == 1) {
+        for (; j + 16 <= cells; j += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + j));
+            __m128i eq = _mm_cmpeq_epi8(v, zero);
+            __m128i lo = _mm_unpacklo_epi8(eq, eq);
+            __m128i hi = _mm_unpackhi_epi8(eq, eq);
+            __m128i parts[4] = {_mm_unpacklo_epi16(lo, lo), _mm_unpackhi_epi16(lo, lo),
+                                _mm_unpacklo_epi16(hi, hi), _mm_unpackhi_epi16(hi, hi)};
+            for (int k = 0; k < 4; ++k) {
+                __m128i* dst = reinterpret_cast<__m128i*>(counts + j + 4 * k);
+                __m128i c = _mm_loadu_si128(dst);
+                _mm_storeu_si128(dst, _mm_add_epi32(c, _mm_add_epi32(one, parts[k])));
+            }
+        }
+    }
+    addScalar(counts + j, row + j * cellBytes, cells - j, cellBytes);
+}
+#endif // LAB11_SSE2
+
+#ifdef LAB11_X86
+// ---------------------------------------------------------------------
+// AVX2: 32 bytes per step.  Compiled for AVX2 regardless of the global
+// flags and only called after a CPUID check.
+
+__attribute__((target("avx2")))
+void orAvx2(std::uint8_t* dst, const std::uint8_t* src, std::size_t bytes) {
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(a, b));
+    }
+    orScalar(dst + i, src + i, bytes - i);
+}
+
+__attribute__((target("avx2")))
+inline std::uint32_t nonzeroMask32(__m256i v) {
+    __m256i zero = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+    return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(zero));
+}
+
+__attribute__((target("avx2")))
+std::size_t findAvx2(const std::uint8_t* p, std::size_t begin, std::size_t end) {
+    std::size_t i = begin;
+    for (; i + 32 <= end; i += 32) {
+        std::uint32_t m =
+            nonzeroMask32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+        if (m != 0) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return findScalar(p, i, end);
+}
+
+__attribute__((target("avx2")))
+std::size_t findAndAvx2(const std::uint8_t* a, const std::uint8_t* b, std::size_t begin,
+                        std::size_t end) {
+    std::size_t i = begin;
+    for (; i + 32 <= end; i += 32) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        std::uint32_t m = nonzeroMask32(_mm256_and_si256(x, y));
+        if (m != 0) return i + static_cast<std::size_t>(__builtin_ctz(m));
+    }
+    return findAndScalar(a, b, i, end);
+}
+
+__attribute__((target("avx2")))
+inline std::uint32_t zeroCellMask32(__m256i v, std::size_t cellBytes) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i eq = cellBytes == 4 ? _mm256_cmpeq_epi32(v, zero)
+                 : cellBytes == 2 ? _mm256_cmpeq_epi16(v, zero)
+                                  : _mm256_cmpeq_epi8(v, zero);
+    return static_cast<std::uint32_t>(_mm256_movemask_epi8(eq));
+}
+
+__attribute__((target("avx2")))
+std::size_t countAvx2(const std::uint8_t* p, std::size_t cells, std::size_t cellBytes) {
+    const std::size_t bytes = cells * cellBytes;
+    std::size_t nonzeroBytes = 0;
+    std::size_t i = 0;
+    for (; i + 32 <= bytes; i += 32) {
+        std::uint32_t zero = zeroCellMask32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), cellBytes);
+        nonzeroBytes += 32 - static_cast<std::size_t>(__builtin_popcount(zero));
+    }
+    return nonzeroBytes / cellBytes + countScalar(p + i, (bytes - i) / cellBytes, cellBytes);
+}
+
+__attribute__((target("avx2")))
+void addAvx2(int* counts, const std::uint8_t* row, std::size_t cells, std::size_t cellBytes) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    std::size_t j = 0;
+    if (cellBytes == 4) {
+        for (; j + 8 <= cells; j += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j * 4));
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + j));
+            c = _mm256_add_epi32(c, _mm256_add_epi32(one, _mm256_cmpeq_epi32(v, zero)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(counts + j), c);
+        }
+    } else if (cellBytes == 1) {
+        for (; j + 8 <= cells; j += 8) {
+            __m128i bytes8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + j));
+            __m256i v = _mm256_cvtepu8_epi32(bytes8);
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(counts + j));
+            c = _mm256_add_epi32(c, _mm256_add_epi32(one, _mm256_cmpeq_epi32(v, zero)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(counts + j), c);
+        }
+    }
+    addScalar(counts + j, row + j * cellBytes, cells - j, cellBytes);
+}
+
+// Eight rows per step: gather the aligned 4‑byte word holding the cell
+// from each row and mask out the other bytes of the word.
+__attribute__((target("avx2")))
+std::size_t columnAvx2(const std::uint8_t* base, std::size_t strideBytes,
+                       std::size_t byteOffset, std::size_t cellBytes, std::size_t rowBegin,
+                       std::size_t rowEnd) {
+    const std::size_t word = byteOffset & ~std::size_t(3);
+    const std::uint32_t cellMask =
+        (cellBytes >= 4 ? 0xFFFFFFFFu : (1u << (8 * cellBytes)) - 1u) << (8 * (byteOffset & 3));
+    const __m256i mask = _mm256_set1_epi32(static_cast<int>(cellMask));
+    const int s = static_cast<int>(strideBytes);
+    const __m256i index = _mm256_setr_epi32(0, s, 2 * s, 3 * s, 4 * s, 5 * s, 6 * s, 7 * s);
+    std::size_t r = rowBegin;
+    for (; r + 8 <= rowEnd; r += 8) {
+        const int* first = reinterpret_cast<const int*>(base + r * strideBytes + word);
+        __m256i v = _mm256_and_si256(_mm256_i32gather_epi32(first, index, 1), mask);
+        std::uint32_t zero = static_cast<std::uint32_t>(
+            _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, _mm256_setzero_si256()))));
+        if (zero != 0) return r + static_cast<std::size_t>(__builtin_ctz(zero));
+    }
+    return columnScalar(base, strideBytes, byteOffset, cellBytes, r, rowEnd);
+}
+#endif // LAB11_X86
+
+// The kernel set chosen for this CPU.
+struct KernelTable {
+    OrFn orRow;
+    FindFn find;
+    FindAndFn findAnd;
+    CountFn count;
+    AddFn add;
+    ColumnFn column;
+    const char* name;
+};
+
+KernelTable selectKernels() {
+#ifdef LAB11_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return {orAvx2, findAvx2, findAndAvx2, countAvx2, addAvx2, columnAvx2, "avx2"};
+    }
+#endif
+#ifdef LAB11_SSE2
+    // SSE2 has no gather; the column scan stays scalar.
+    return {orSse2, findSse2, findAndSse2, countSse2, addSse2, columnScalar, "sse2"};
+#else
+    return {orScalar, findScalar, findAndScalar, countScalar, addScalar, columnScalar, "scalar"};
+#endif
+}
+
+const KernelTable& kernels() {
+    static const KernelTable table = selectKernels();
+    return table;
+}
+
+} // namespace
+
+void orBytes(void* dst, const void* src, std::size_t bytes) {
+    kernels().orRow(static_cast<std::uint8_t*>(dst), static_cast<const std::uint8_t*>(src),
+                    bytes);
+}
+
+std::size_t findNonzeroByte(const void* p, std::size_t begin, std::size_t end) {
+    return kernels().find(static_cast<const std::uint8_t*>(p), begin, end);
+}
+
+std::size_t findNonzeroAndByte(const void* a, const void* b, std::size_t begin, std::size_t end) {
+    return kernels().findAnd(static_cast<const std::uint8_t*>(a),
+                             static_cast<const std::uint8_t*>(b), begin, end);
+}
+
+std::size_t countNonzeroCells(const void* p, std::size_t cells, std::size_t cellBytes) {
+    return kernels().count(static_cast<const std::uint8_t*>(p), cells, cellBytes);
+}
+
+void addNonzeroCells(int* counts, const void* row, std::size_t cells, std::size_t cellBytes) {
+    kernels().add(counts, static_cast<const std::uint8_t*>(row), cells, cellBytes);
+}
+
+std::size_t findZeroCellInColumn(const void* base, std::size_t strideBytes,
+                                 std::size_t byteOffset, std::size_t cellBytes,
+                                 std::size_t rowBegin, std::size_t rowEnd) {
+    return kernels().column(static_cast<const std::uint8_t*>(base), strideBytes, byteOffset,
+                            cellBytes, rowBegin, rowEnd);
+}
+
+const char* simdLevel() {
+    return kernels().name;
+}
@@ -0,0 +1,149 @@
+// SquareEngine.cpp
+// Implementation of the square engine declared in SquareEngine.h
+
+#include "../include/SquareEngine.h"
+#include "../include/Metrics.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// Rows handed to a thread at once.
+static const std::size_t kRowGrain = 1024;
+
+namespace {
+
+// Sparse accumulator for one row of G^2.  A bit set marks the targets
+// already emitted and the touched list remembers which bits to clear.
+struct RowAccumulator {
+    std::vector<std::uint64_t> marks;
+    std::vector<int> touched;
+
+    explicit RowAccumulator(int n) : marks((static_cast<std::size_t>(n) + 63) / 64, 0) {}
+
+    // Mark w; return true if it was not marked before.
+    bool insert(int w) {
+        std::uint64_t bit = std::uint64_t(1) << (w % 64);
+        std::uint64_t& word = marks[w / 64];
+        if (word & bit) return false;
+        word |= bit;
+        touched.push_back(w);
+        return true;
+    }
+
+    // Clear the marks of all touched vertices.
+    void reset() {
+        for (int w : touched) marks[w / 64] = 0;
+        touched.clear();
+    }
+};
+
+} // namespace
+
+// Collect row u of G^2 in the accumulator: direct neighbours first, then
+// two‑step targets, in the same order as CsrGraph::squareGraph.
+static void accumulateRow(const CsrView& g, int u, RowAccumulator& acc) {
+    for (int v : g.neighbours(u)) {
+        if (v != u) acc.insert(v);
+    }
+    for (int v : g.neighbours(u)) {
+        for (int w : g.neighbours(v)) {
+            if (w != u) acc.insert(w);
+        }
+    }
+}
+
+// Sum the lengths of all paths of length one or two.
+std::uint64_t estimateSquareEdges(const CsrView& g) {
+    std::uint64_t total = 0;
+    for (int u = 0; u < g.size(); ++u) {
+        total += g.degree(u);
+        for (int v : g.neighbours(u)) {
+            total += g.degree(v);
+        }
+    }
+    return total;
+}
+
+// Symbolic pass: fill rowSize[u] with the number of edges of row u.
+static void symbolicPass(const CsrView& g, ThreadPool& pool,
+                         std::vector<std::uint64_t>& rowSize) {
+    int n = g.size();
+    std::vector<RowAccumulator> acc(pool.size(), RowAccumulator(0));
+    pool.run([&](int t) { acc[t] = RowAccumulator(n); });
+    pool.parallelFor(n, kRowGrain, [&](int t, std::size_t begin, std::size_t end) {
+        RowAccumulator& a = acc[t];
+        for (std::size_t u = begin; u < end; ++u) {
+            accumulateRow(g, static_cast<int>(u), a);
+            rowSize[u] = a.touched.size();
+            a.reset();
+        }
+    });
+}
+
+// Count the edges of G^2 with the symbolic pass.
+std::uint64_t countSquareEdges(const CsrView& g, ThreadPool& pool) {
+    LAB11_METRICS_SCOPE(metrics, "countSquareEdges");
+    LAB11_METRICS_EDGES(metrics, estimateSquareEdges(g));
+    std::vector<std::uint64_t> rowSize(g.size(), 0);
+    symbolicPass(g, pool, rowSize);
+    std::uint64_t total = 0;
+    for (std::uint64_t s : rowSize) total += s;
+    return total;
+}
+
+// Two‑pass square: symbolic counts, prefix sum, numeric fill.
+CsrGraph parallelSquareGraph(const CsrView& g, ThreadPool& pool) {
+    LAB11_METRICS_SCOPE(metrics, "parallelSquareGraph");
+    // Both passes scan every path of length one or two.
+    LAB11_METRICS_EDGES(metrics, 2 * estimateSquareEdges(g));
+    int n = g.size();
+    std::vector<std::uint64_t> offsets(n + 1, 0);
+    {
+        std::vector<std::uint64_t> rowSize(n, 0);
+        symbolicPass(g, pool, rowSize);
+        for (int u = 0; u < n; ++u) {
+            offsets[u + 1] = offsets[u] + rowSize[u];
+        }
+    }
+    std::vector<int> targets(offsets[n]);
+    std::vector<RowAccumulator> acc(pool.size(), RowAccumulator(0));
+    pool.run([&](int t) { acc[t] = RowAccumulator(n); });
+    pool.parallelFor(n, kRowGrain, [&](int t, std::size_t begin, std::size_t end) {
+        RowAccumulator& a = acc[t];
+        for (std::size_t u = begin; u < end; ++u) {
+            accumulateRow(g, static_cast<int>(u), a);
+            std::copy(a.touched.begin(), a.touched.end(), targets.begin() + offsets[u]);
+            a.reset();
+        }
+    });
+    return CsrGraph::fromArrays(n, std::move(offsets), std::move(targets));
+}
+
+// Run the parallel square on a temporary pool.
+CsrGraph parallelSquareGraph(const CsrView& g, int numThreads) {
+    ThreadPool pool(numThreads);
+    return parallelSquareGraph(g, pool);
+}
+
+// The row loop of CsrGraph::squareGraph, one row per call.  The marks
+// live in a shared_ptr so that copies of the source share them.
+RowSource squareRows(const CsrView& g) {
+    auto marked = std::make_shared<std::vector<char>>(g.size(), 0);
+    return [g, marked](int u, std::vector<int>& row) {
+        std::vector<char>& mark = *marked;
+        std::size_t rowStart = row.size();
+        for (int v : g.neighbours(u)) {
+            if (v == u || mark[v]) continue;
+            mark[v] = 1;
+            row.push_back(v);
+        }
+        for (int v : g.neighbours(u)) {
+            for (int w : g.neighbours(v)) {
+                if (w == u || mark[w]) continue;
+                mark[w] = 1;
+                row.push_back(w);
+            }
+        }
+        for (std::size_t i = rowStart; i < row.size(); ++i) mark[row[i]] = 0;
+    };
+}
@@ -0,0 +1,122 @@
+// ThreadPool.cpp
+// Implementation of ThreadPool declared in ThreadPool.h
+
+#include "../include/ThreadPool.h"
+#include <atomic>
+
+// Start numThreads ‑ 1 workers; the caller acts as thread 0.
+ThreadPool::ThreadPool(int numThreads)
+    : task(nullptr), generation(0), pending(0), stopping(false) {
+    if (numThreads <= 0) numThreads = defaultThreadCount();
+    for (int i = 1; i < numThreads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+// Wake every worker with the stop flag set and join them.
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& t : workers) {
+        t.join();
+    }
+}
+
+// Return the number of threads, including the caller.
+int ThreadPool::size() const {
+    return static_cast<int>(workers.size()) + 1;
+}
+
+// Publish the task under a new generation number, run it as thread 0
+// and wait until every worker has reported completion.
+void ThreadPool::run(const std::function<void(int)>& fn) {
+    if (workers.empty()) {
+        fn(0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &fn;
+        pending = static_cast<int>(workers.size());
+        ++generation;
+    }
+    wake.notify_all();
+    fn(0);
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+}
+
+// Hand out chunks of the index range through a shared atomic counter, so
+// threads that finish early take over the remaining work.
+void ThreadPool::parallelFor(std::size_t count, std::size_t grain,
+                             const std::function<void(int, std::size_t, std::size_t)>& body) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+    if (workers.empty() || count <= grain) {
+        body(0, 0, count);
+        return;
+    }
+    std::atomic<std::size_t> nextChunk(0);
+    run([&](int thread) {
+        for (;;) {
+            std::size_t begin = nextChunk.fetch_add(grain, std::memory_order_relaxed);
+            if (begin >= count) break;
+            std::size_t end = begin + grain < count ? begin + grain : count;
+            body(thread, begin, end);
+        }
+    });
+}
+
+// Return the number of hardware threads.
+int ThreadPool::defaultThreadCount() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<int>(n);
+}
+
+// Wait for a new generation, run the published task and report back.
+void ThreadPool::workerLoop(int index) {
+    std::size_t seen = 0;
+    for (;;) {
+        const std::function<void(int)>* current;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            current = task;
+        }
+        (*current)(index);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) done.notify_one();
+        }
+    }
+}
+
+// One thread without a pool.
+int threadCount(const ThreadPool* pool) {
+    return pool ? pool->size() : 1;
+}
+
+// Run the task on the pool, or once on the calling thread.
+void runOnThreads(ThreadPool* pool, const std::function<void(int)>& task) {
+    if (pool) {
+        pool->run(task);
+    } else {
+        task(0);
+    }
+}
+
+// Run the loop on the pool, or as one chunk on the calling thread.
+void parallelFor(ThreadPool* pool, std::size_t count, std::size_t grain,
+                 const std::function<void(int, std::size_t, std::size_t)>& body) {
+    if (pool) {
+        pool->parallelFor(count, grain, body);
+    } else if (count > 0) {
+        body(0, 0, count);
+    }
+}
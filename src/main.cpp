@@ -3,54 +3,96 @@
 // in Graph.h and GraphMatrix.h.  This program reads a directed graph
 // from standard input, builds both an adjacency list and adjacency
 // matrix representation, and then demonstrates the various
-// operations: transpose, square, BFS, universal sink detection and
-// conversion to a simple undirected graph.
+// operations: transpose, strongly connected components, square, BFS,
+// universal sink detection and conversion to a simple undirected graph,
+// and point queries on the lazy views of GraphViews.h.
+//
+// If a file name is given on the command line, the graph is loaded from
+// that text edge list (one "u v" pair per line) with the parallel
+// parser from EdgeListReader.h instead of being typed in.  A graph read
+// from a file with more than 64 vertices, as such files usually have,
+// is summarised: the adjacency matrices are not built and only the sizes
+// are printed.  Typed‑in graphs are always printed in full.
+//
+// With --stats [json|prometheus] the metrics of every algorithm that ran
+// (see Metrics.h) are printed at the end; this needs a build with
+// -DLAB11_METRICS=ON.
+//
+// With --dump DIR the graph, its transpose and its square are also
+// written into DIR as text edge lists (graph.txt, transpose.txt,
+// square.txt, see GraphWriter.h) that the .py/plot_*.py scripts read,
+// and the graph and its square as binary graph files graph.bin and
+// square.bin (see GraphFile.h).
 
 #include <iostream>
+#include <string>
 #include "../include/Graph.h"
 #include "../include/GraphMatrix.h"
+#include "../include/CsrGraph.h"
+#include "../include/DegreeStats.h"
+#include "../include/EdgeListReader.h"
+#include "../include/GraphViews.h"
+#include "../include/GraphWriter.h"
+#include "../include/Metrics.h"
+#include "../include/Scc.h"
+#include "../include/SquareEngine.h"
+
+// Graphs read from a file with more vertices than this are summarised:
+// the adjacency matrices (n^2 cells) are not built and the lists are not
+// printed.
+const int kMaxPrintedVertices = 64;
 
 // Helper function to print an adjacency list
 static void printAdjList(const Graph &g) {
-    const auto &adj = g.getAdjacencyList();
-    for (int u = 0; u < g.size(); ++u) {
-        std::cout << u << ": ";
-        for (size_t i = 0; i < adj[u].size(); ++i) {
-            std::cout << adj[u][i];
-            if (i + 1 < adj[u].size()) std::cout << ", ";
-        }
-        std::cout << std::endl;
-    }
+    OutputBuffer out(std::cout);
+    writeAdjacencyList(out, g);
 }
 
 // Helper function to print an adjacency matrix
 static void printAdjMatrix(const GraphMatrix &gm) {
-    const auto &mat = gm.getMatrix();
-    int n = gm.size();
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            std::cout << mat[i][j] << " ";
-        }
-        std::cout << std::endl;
+    OutputBuffer out(std::cout);
+    writeAdjacencyMatrix(out, gm);
+}
+
+// Join the vertices of a range with ", ".
+static std::string formatRange(NeighbourRange range) {
+    std::string text;
+    for (int v : range) {
+        if (!text.empty()) text += ", ";
+        text += std::to_string(v);
     }
+    return text;
 }
 
-// Entry point
-int main() {
+// Read the graph interactively: vertex and edge counts followed by m
+// pairs of vertices.  Returns false on invalid input.
+static bool readInteractive(int &n, EdgeList &edges) {
+    std::ios::sync_with_stdio(false);
     std::cout << "Введите количество вершин и ребер графа: ";
-    int n, m;
+    int m;
     if (!(std::cin >> n >> m)) {
-        std::cerr << "Неверный ввод." << std::endl;
-        return 1;
+        return false;
     }
-    Graph g(n);
-    GraphMatrix gm(n);
     std::cout << "Введите пары вершин для направленных ребер (u v):" << std::endl;
+    edges.reserve(m > 0 ? m : 0);
     for (int i = 0; i < m; ++i) {
         int u, v;
-        std::cin >> u >> v;
-        g.addEdge(u, v);
-        gm.setEdge(u, v, 1);
+        if (!(std::cin >> u >> v)) {
+            return false;
+        }
+        edges.emplace_back(u, v);
+    }
+    return true;
+}
+
+// Full output for a small graph: every list and matrix, the component
+// of every vertex, the degrees and both BFS orders.  The matrix is
+// filled from the same edge list as the lists.
+static void runSmall(const Graph &g, const EdgeList &edges, ThreadPool &pool) {
+    int n = g.size();
+    GraphMatrix gm(n);
+    for (const auto &e : edges) {
+        gm.setEdge(e.first, e.second, 1);
     }
     std::cout << "Исходный граф (списки смежности):" << std::endl;
     printAdjList(g);
@@ -69,13 +111,37 @@ int main() {
     printAdjMatrix(gmT);
     std::cout << std::endl;
 
-    // Universal sink
+    // Strongly connected components and the condensation
+    SccResult scc = tarjanSCC(g);
+    std::cout << "Сильно связные компоненты (" << scc.count << "):" << std::endl;
+    for (int v = 0; v < n; ++v) {
+        std::cout << v << " -> " << scc.component[v] << std::endl;
+    }
+    std::cout << std::endl;
+    std::cout << "Граф конденсации (списки смежности):" << std::endl;
+    printAdjList(condensation(g, scc));
+    std::cout << std::endl;
+
+    // Degrees, sources and sinks from the adjacency lists in one pass
+    DegreeStats stats = computeDegreeStats(g, DegreeStatsRequest(), &pool);
+    std::cout << "Степени вершин (исхода / захода):" << std::endl;
+    for (int v = 0; v < n; ++v) {
+        std::cout << v << ": " << stats.outDegree[v] << " / " << stats.inDegree[v] << std::endl;
+    }
+    std::cout << "Источников: " << stats.sources.size() << ", стоков: " << stats.sinks.size()
+              << std::endl;
+    std::cout << std::endl;
+
+    // Universal sink, from the matrix and from the lists
     int sink = gm.findUniversalSink();
     if (sink != -1) {
         std::cout << "Универсальный сток найден: вершина " << sink << std::endl;
     } else {
         std::cout << "Универсального стока нет." << std::endl;
     }
+    if (stats.universalSink != sink) {
+        std::cout << "По спискам смежности найден другой сток: " << stats.universalSink << std::endl;
+    }
     std::cout << std::endl;
 
     // BFS from vertex 0 using adjacency matrix
@@ -106,11 +172,128 @@ int main() {
     printAdjMatrix(gm2);
     std::cout << std::endl;
 
+    // Point queries on lazy views: only the rows of vertex 0 are computed
+    if (n > 0) {
+        TransposeView viewT(g);
+        SquareView view2(g);
+        UndirectedView viewU(g);
+        std::cout << "Соседи вершины 0 (ленивые представления):" << std::endl;
+        std::cout << "  транспонированный граф: " << formatRange(viewT.neighbours(0)) << std::endl;
+        std::cout << "  квадрат графа:          " << formatRange(view2.neighbours(0)) << std::endl;
+        std::cout << "  неориентированный граф: " << formatRange(viewU.neighbours(0)) << std::endl;
+        std::cout << std::endl;
+    }
+
     // Convert multigraph to simple undirected graph
     Graph gSimple = g.toSimpleUndirected();
     std::cout << "Эквивалентный простой неориентированный граф:" << std::endl;
     printAdjList(gSimple);
     std::cout << std::endl;
+}
+
+// Short output for a large graph, such as a SNAP edge list: the n x n
+// matrices are not built and only the sizes of the results are printed.
+static void runLarge(const Graph &g, ThreadPool &pool) {
+    int n = g.size();
+    std::cout << "Граф больше " << kMaxPrintedVertices
+              << " вершин: матрица смежности не строится, выводятся только размеры."
+              << std::endl << std::endl;
+    std::cout << "Вершин: " << n << ", рёбер: " << g.numEdges() << std::endl << std::endl;
+
+    Graph gT = g.getTranspose();
+    std::cout << "Транспонированный граф: рёбер " << gT.numEdges() << std::endl << std::endl;
+
+    SccResult scc = tarjanSCC(g);
+    std::cout << "Сильно связных компонент: " << scc.count << std::endl << std::endl;
+
+    DegreeStats stats = computeDegreeStats(g, DegreeStatsRequest(), &pool);
+    std::cout << "Источников: " << stats.sources.size() << ", стоков: " << stats.sinks.size()
+              << std::endl;
+    if (stats.universalSink != -1) {
+        std::cout << "Универсальный сток найден: вершина " << stats.universalSink << std::endl;
+    } else {
+        std::cout << "Универсального стока нет." << std::endl;
+    }
+    std::cout << std::endl;
+
+    std::cout << "BFS от вершины 0: достигнуто вершин " << g.BFS(0).size() << std::endl
+              << std::endl;
+
+    // The square is only counted, never built
+    CsrGraph csr = CsrGraph::fromGraph(g);
+    std::cout << "Квадрат графа: рёбер " << countSquareEdges(csr.view(), pool) << std::endl;
+    Graph gSimple = g.toSimpleUndirected(&pool);
+    std::cout << "Эквивалентный простой неориентированный граф: рёбер "
+              << gSimple.numEdges() / 2 << std::endl << std::endl;
+}
+
+// Entry point
+int main(int argc, char **argv) {
+    const char *inputFile = nullptr;
+    std::string statsFormat;
+    std::string dumpDir;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--stats") {
+            statsFormat = "json";
+            if (i + 1 < argc && (std::string(argv[i + 1]) == "json" ||
+                                 std::string(argv[i + 1]) == "prometheus")) {
+                statsFormat = argv[++i];
+            }
+        } else if (arg == "--dump") {
+            if (i + 1 >= argc) {
+                std::cerr << "Использование: " << argv[0]
+                          << " [--stats [json|prometheus]] [--dump DIR] [файл]" << std::endl;
+                return 1;
+            }
+            dumpDir = argv[++i];
+        } else {
+            inputFile = argv[i];
+        }
+    }
+    if (!statsFormat.empty()) {
+#ifndef LAB11_METRICS
+        std::cerr << "Метрики недоступны: соберите проект с -DLAB11_METRICS=ON." << std::endl;
+#endif
+        Metrics::setEnabled(true);
+        Metrics::setHardwareCounters(true);
+    }
+
+    ThreadPool pool;
+    int n = 0;
+    EdgeList edges;
+    if (inputFile) {
+        int maxVertex = -1;
+        std::string error;
+        if (!readEdgeListFile(inputFile, edges, maxVertex, pool, &error)) {
+            std::cerr << "Ошибка чтения файла: " << error << std::endl;
+            return 1;
+        }
+        n = maxVertex + 1;
+    } else if (!readInteractive(n, edges)) {
+        std::cerr << "Неверный ввод." << std::endl;
+        return 1;
+    }
+    // Bulk build of the adjacency lists
+    Graph g = Graph::fromEdges(n, edges, EdgeBuildOptions(), &pool);
+    if (!dumpDir.empty()) {
+        std::string error;
+        if (!writeGraphDump(dumpDir, g, &error)) {
+            std::cerr << "Ошибка записи графов: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Графы записаны в " << dumpDir << std::endl << std::endl;
+    }
+    if (inputFile && n > kMaxPrintedVertices) {
+        runLarge(g, pool);
+    } else {
+        runSmall(g, edges, pool);
+    }
 
+    if (statsFormat == "prometheus") {
+        std::cout << Metrics::toPrometheus();
+    } else if (!statsFormat.empty()) {
+        std::cout << Metrics::toJson();
+    }
     return 0;
 }
\ No newline at end of file
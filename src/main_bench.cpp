@@ -0,0 +1,643 @@
+// main_bench.cpp
+// Замеры производительности алгоритмов на больших случайных графах.
+//
+// Режимы:
+//   compare  — сравнение представлений (списки смежности Graph, CSR,
+//              матрицы GraphMatrix и ByteGraphMatrix, битовая матрица)
+//              на операциях BFS, транспонирование, квадрат, упрощение
+//              и поиск стока; статистика степеней и сток по спискам;
+//              вывод списка рёбер графа и его квадрата (построчно, без
+//              построения) в /dev/null через OutputBuffer; 64 строки
+//              ленивых представлений (транспонирование, квадрат,
+//              неориентированный граф) против построения целиком;
+//              шаблонные ядра GraphKernels.h на 32-битных номерах вершин
+//              (BFS с проверкой границ и без, транспонирование);
+//              BFS из 256 вершин по одной и пакетом;
+//   scaling  — масштабирование параллельного BFS по числу потоков;
+//   transpose — транспонирование плотной матрицы в одном буфере:
+//              наивный цикл, блочный, блочный параллельный и «на месте»
+//              (в столбце edges_per_sec — ячеек матрицы в секунду);
+//   reorder  — перенумерация вершин (degree, bfs, rcm) и BFS,
+//              транспонирование и квадрат CSR до и после неё;
+//   generate — генерация графа модели --model потоком прямо в CSR
+//              по числу потоков (результат не зависит от числа потоков);
+//   scc      — сильно связные компоненты: Косарайю и Тарьян против
+//              параллельного forward-backward с раскраской по числу
+//              потоков, затем конденсация.
+//
+// Параметры командной строки:
+//   --mode M        compare, scaling, transpose, reorder, generate или scc
+//                   (по умолчанию compare)
+//   --input FILE    взять граф из файла со списком рёбер вместо генератора
+//   --model M       модель графа: er (Эрдёш–Реньи), rmat или ba (Барабаши–Альберт,
+//                   degree рёбер на вершину); по умолчанию er
+//   --vertices N    число вершин (по умолчанию 100000)
+//   --degree D      средняя полустепень исхода (по умолчанию 8)
+//   --rmat A,B,C    вероятности R-MAT (по умолчанию 0.57,0.19,0.19)
+//   --max-dense N   наибольшее n для плотных матриц (по умолчанию 4096)
+//   --max-bit N     наибольшее n для битовой матрицы (по умолчанию 16384)
+//   --sizes LIST    размеры матриц для transpose (по умолчанию 8192,16384,32768;
+//                   матрица 32768 x 32768 из int занимает 4 ГБ, нужны две)
+//   --threads LIST  числа потоков через запятую (по умолчанию 1,2,4,8,16)
+//   --warmup W      число прогревочных запусков (по умолчанию 1)
+//   --reps R        число замеряемых повторов (по умолчанию 5)
+//   --seed S        зерно генератора (по умолчанию 1)
+//   --format F      csv или json (по умолчанию csv)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "../include/BfsEngine.h"
+#include "../include/BitMatrixGraph.h"
+#include "../include/CompressedGraph.h"
+#include "../include/CsrGraph.h"
+#include "../include/DegreeStats.h"
+#include "../include/EdgeListReader.h"
+#include "../include/Generator.h"
+#include "../include/Graph.h"
+#include "../include/GraphKernels.h"
+#include "../include/GraphMatrix.h"
+#include "../include/GraphViews.h"
+#include "../include/GraphWorkspace.h"
+#include "../include/GraphWriter.h"
+#include "../include/MatrixKernels.h"
+#include "../include/Reorder.h"
+#include "../include/Scc.h"
+#include "../include/SquareEngine.h"
+#include "../include/ThreadPool.h"
+
+// Параметры запуска
+struct BenchConfig {
+    std::string mode = "compare";
+    std::string model = "er";
+    std::string input;
+    int vertices = 100000;
+    int degree = 8;
+    double rmatA = 0.57;
+    double rmatB = 0.19;
+    double rmatC = 0.19;
+    int maxDense = 4096;
+    int maxBit = 16384;
+    std::vector<int> sizes = {8192, 16384, 32768};
+    std::vector<int> threads = {1, 2, 4, 8, 16};
+    int warmup = 1;
+    int reps = 5;
+    unsigned long long seed = 1;
+    std::string format = "csv";
+};
+
+// Результат одного замера
+struct BenchResult {
+    int vertices;
+    std::string representation;
+    std::string operation;
+    int threads;
+    double medianMs;
+    double p95Ms;
+    double edgesPerSec;
+    long peakRssKb;
+};
+
+// Разбор списка чисел через запятую
+static std::vector<double> parseList(const std::string &text) {
+    std::vector<double> values;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(std::atof(item.c_str()));
+        }
+    }
+    return values;
+}
+
+// Разбор аргументов командной строки
+static bool parseArgs(int argc, char **argv, BenchConfig &cfg) {
+    for (int i = 1; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            std::cerr << "Не задано значение для " << argv[i] << std::endl;
+            return false;
+        }
+        std::string key = argv[i];
+        std::string value = argv[++i];
+        if (key == "--mode") {
+            cfg.mode = value;
+        } else if (key == "--model") {
+            cfg.model = value;
+        } else if (key == "--input") {
+            cfg.input = value;
+        } else if (key == "--vertices") {
+            cfg.vertices = std::atoi(value.c_str());
+        } else if (key == "--degree") {
+            cfg.degree = std::atoi(value.c_str());
+        } else if (key == "--rmat") {
+            std::vector<double> p = parseList(value);
+            if (p.size() != 3) {
+                std::cerr << "--rmat ожидает три числа" << std::endl;
+                return false;
+            }
+            cfg.rmatA = p[0];
+            cfg.rmatB = p[1];
+            cfg.rmatC = p[2];
+        } else if (key == "--max-dense") {
+            cfg.maxDense = std::atoi(value.c_str());
+        } else if (key == "--max-bit") {
+            cfg.maxBit = std::atoi(value.c_str());
+        } else if (key == "--sizes") {
+            cfg.sizes.clear();
+            for (double v : parseList(value)) {
+                cfg.sizes.push_back(static_cast<int>(v));
+            }
+        } else if (key == "--threads") {
+            cfg.threads.clear();
+            for (double t : parseList(value)) {
+                cfg.threads.push_back(static_cast<int>(t));
+            }
+        } else if (key == "--warmup") {
+            cfg.warmup = std::atoi(value.c_str());
+        } else if (key == "--reps") {
+            cfg.reps = std::atoi(value.c_str());
+        } else if (key == "--seed") {
+            cfg.seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (key == "--format") {
+            cfg.format = value;
+        } else {
+            std::cerr << "Неизвестный параметр: " << key << std::endl;
+            return false;
+        }
+    }
+    if (cfg.mode != "compare" && cfg.mode != "scaling" && cfg.mode != "transpose" &&
+        cfg.mode != "reorder" && cfg.mode != "generate" && cfg.mode != "scc") {
+        std::cerr << "Неизвестный режим: " << cfg.mode << std::endl;
+        return false;
+    }
+    if (cfg.model != "er" && cfg.model != "rmat" && cfg.model != "ba") {
+        std::cerr << "Неизвестная модель графа: " << cfg.model << std::endl;
+        return false;
+    }
+    if (cfg.format != "csv" && cfg.format != "json") {
+        std::cerr << "Неизвестный формат: " << cfg.format << std::endl;
+        return false;
+    }
+    return cfg.vertices > 0 && cfg.degree >= 0 && cfg.reps > 0 && cfg.warmup >= 0 &&
+           !cfg.threads.empty();
+}
+
+// Вероятности R-MAT из параметров запуска
+static RmatParams rmatParams(const BenchConfig &cfg) {
+    RmatParams params;
+    params.a = cfg.rmatA;
+    params.b = cfg.rmatB;
+    params.c = cfg.rmatC;
+    return params;
+}
+
+// Пиковый объём резидентной памяти процесса (КБ)
+static long peakRssKb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Замер функции: прогрев, повторы, медиана и 95-й перцентиль
+static BenchResult measure(const BenchConfig &cfg, int vertices, const std::string &representation,
+                           const std::string &operation, int threads, size_t edges,
+                           const std::function<void()> &fn) {
+    for (int w = 0; w < cfg.warmup; ++w) {
+        fn();
+    }
+    std::vector<double> times;
+    for (int r = 0; r < cfg.reps; ++r) {
+        auto t0 = std::chrono::steady_clock::now();
+        fn();
+        auto t1 = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    std::sort(times.begin(), times.end());
+    BenchResult res;
+    res.vertices = vertices;
+    res.representation = representation;
+    res.operation = operation;
+    res.threads = threads;
+    res.medianMs = times[times.size() / 2];
+    size_t p95 = (times.size() * 95 + 99) / 100;
+    res.p95Ms = times[std::min(times.size() - 1, p95 == 0 ? 0 : p95 - 1)];
+    res.edgesPerSec = res.medianMs > 0 ? edges / (res.medianMs / 1000.0) : 0;
+    res.peakRssKb = peakRssKb();
+    return res;
+}
+
+// Запись в /dev/null через OutputBuffer: замеряется форматирование и
+// буферизация вывода без диска
+static void writeToNull(const std::function<void(OutputBuffer &)> &write) {
+    std::FILE *f = std::fopen("/dev/null", "wb");
+    if (!f) {
+        return;
+    }
+    {
+        OutputBuffer out(f);
+        write(out);
+    }
+    std::fclose(f);
+}
+
+// Сравнение представлений графа
+static bool runCompare(const BenchConfig &cfg, const EdgeList &edges,
+                       std::vector<BenchResult> &results) {
+    int n = cfg.vertices;
+    CsrGraph csr = CsrGraph::fromEdges(n, edges);
+    size_t m = csr.numEdges();
+    int start = 0;
+
+    {
+        Graph g = csr.toGraph();
+        results.push_back(measure(cfg, n, "list", "bfs", 1, m, [&] { g.BFS(start); }));
+        results.push_back(measure(cfg, n, "list", "transpose", 1, m, [&] { g.getTranspose(); }));
+        results.push_back(measure(cfg, n, "list", "square", 1, m, [&] { g.squareGraph(); }));
+        results.push_back(measure(cfg, n, "list", "simple", 1, m, [&] { g.toSimpleUndirected(); }));
+        results.push_back(measure(cfg, n, "list", "sink", 1, m, [&] { findUniversalSink(g); }));
+
+        // Те же операции с переиспользуемым рабочим пространством
+        GraphWorkspace ws;
+        Graph out(0);
+        results.push_back(measure(cfg, n, "list_workspace", "bfs", 1, m, [&] { g.BFS(start, ws); }));
+        results.push_back(measure(cfg, n, "list_workspace", "transpose", 1, m,
+                                  [&] { g.getTranspose(out, ws); }));
+        results.push_back(measure(cfg, n, "list_workspace", "square", 1, m,
+                                  [&] { g.squareGraph(out, ws); }));
+        results.push_back(measure(cfg, n, "list_workspace", "simple", 1, m,
+                                  [&] { g.toSimpleUndirected(out, ws); }));
+    }
+
+    results.push_back(measure(cfg, n, "csr", "bfs", 1, m, [&] { csr.BFS(start); }));
+    {
+        // Шаблонные ядра на 32-битных номерах вершин с проверкой границ и без
+        std::vector<std::uint32_t> targets32(csr.getTargets().begin(), csr.getTargets().end());
+        CsrStorage<std::uint32_t> storage32(static_cast<std::uint32_t>(n), csr.getOffsets().data(),
+                                            targets32.data());
+        std::uint32_t start32 = static_cast<std::uint32_t>(start);
+        results.push_back(measure(cfg, n, "csr_u32", "bfs_unchecked", 1, m,
+                                  [&] { bfsVisitOrder<UncheckedAccess>(storage32, start32); }));
+        results.push_back(measure(cfg, n, "csr_u32", "bfs_checked", 1, m,
+                                  [&] { bfsVisitOrder<CheckedAccess>(storage32, start32); }));
+        results.push_back(measure(cfg, n, "csr_u32", "transpose", 1, m,
+                                  [&] { transposeArrays(storage32); }));
+    }
+    results.push_back(measure(cfg, n, "csr", "transpose", 1, m, [&] { csr.getTranspose(); }));
+    results.push_back(measure(cfg, n, "csr", "square", 1, m, [&] { csr.squareGraph(); }));
+    results.push_back(measure(cfg, n, "csr", "simple", 1, m, [&] { csr.toSimpleUndirected(); }));
+    results.push_back(measure(cfg, n, "csr", "degree_stats", 1, m, [&] { computeDegreeStats(csr); }));
+    results.push_back(measure(cfg, n, "csr", "sink", 1, m, [&] { findUniversalSink(csr); }));
+    results.push_back(measure(cfg, n, "csr", "write_edge_list", 1, m, [&] {
+        writeToNull([&](OutputBuffer &out) { writeEdgeList(out, csr.view()); });
+    }));
+    results.push_back(measure(cfg, n, "csr", "write_square_streamed", 1, m, [&] {
+        writeToNull([&](OutputBuffer &out) { writeEdgeList(out, n, squareRows(csr.view())); });
+    }));
+    {
+        // Ленивые представления: 64 строки по запросу против построения целиком
+        // Строки выбираются отдельным потоком генератора из Generator.h
+        RandomStream rng = RandomStream(cfg.seed, 0).split(2);
+        std::vector<int> rows(64);
+        for (int &v : rows) {
+            v = static_cast<int>(rng.nextBelow(static_cast<std::uint64_t>(n)));
+        }
+        results.push_back(measure(cfg, n, "view", "transpose_64_rows", 1, m, [&] {
+            TransposeView view(csr);
+            view.prefetch(rows);
+        }));
+        results.push_back(measure(cfg, n, "view", "square_64_rows", 1, m, [&] {
+            SquareView view(csr);
+            for (int v : rows) {
+                view.degree(v);
+            }
+        }));
+        results.push_back(measure(cfg, n, "view", "simple_64_rows", 1, m, [&] {
+            UndirectedView view(csr);
+            view.prefetch(rows);
+        }));
+        results.push_back(measure(cfg, n, "view", "square_materialize", 1, m,
+                                  [&] { SquareView(csr).materialize(); }));
+    }
+    {
+        CsrGraph csrT = csr.getTranspose();
+        results.push_back(measure(cfg, n, "csr", "bfs_direction_optimizing", 1, m,
+                                  [&] { directionOptimizingBFS(csr, csrT, start); }));
+    }
+    {
+        // Сжатые списки смежности (разности + varint)
+        CompressedGraph cg = CompressedGraph::fromCsr(csr);
+        results.push_back(measure(cfg, n, "compressed", "build", 1, m,
+                                  [&] { CompressedGraph::fromCsr(csr); }));
+        results.push_back(measure(cfg, n, "compressed", "bfs", 1, m, [&] { cg.BFS(start); }));
+        results.push_back(measure(cfg, n, "compressed", "square", 1, m, [&] { cg.squareGraph(); }));
+    }
+    {
+        // BFS из 256 вершин: по одной и пакетом (MS-BFS)
+        std::vector<int> sources;
+        for (int i = 0; i < 256 && i < n; ++i) {
+            sources.push_back(static_cast<int>((static_cast<long long>(i) * n) / 256));
+        }
+        size_t work = m * sources.size();
+        results.push_back(measure(cfg, n, "csr", "bfs_256_sources_separate", 1, work, [&] {
+            for (int s : sources) topDownBFS(csr, s);
+        }));
+        results.push_back(measure(cfg, n, "csr", "bfs_256_sources_multi", 1, work,
+                                  [&] { multiSourceReach(csr, sources); }));
+    }
+
+    if (n <= cfg.maxDense) {
+        // Плотные матрицы с ячейками int и uint8_t
+        auto runDense = [&](auto &gm, const std::string &name) {
+            for (const auto &e : edges) {
+                gm.setEdge(e.first, e.second, 1);
+            }
+            results.push_back(measure(cfg, n, name, "bfs", 1, m, [&] { gm.BFS(start); }));
+            results.push_back(measure(cfg, n, name, "transpose", 1, m, [&] { gm.getTranspose(); }));
+            results.push_back(measure(cfg, n, name, "square", 1, m, [&] { gm.squareGraph(); }));
+            results.push_back(measure(cfg, n, name, "sink", 1, m, [&] { gm.findUniversalSink(); }));
+            results.push_back(measure(cfg, n, name, "degree_stats", 1, m,
+                                      [&] { computeDegreeStats(gm); }));
+        };
+        GraphMatrix gm(n);
+        runDense(gm, "matrix");
+        ByteGraphMatrix bytes(n);
+        runDense(bytes, "bytematrix");
+    }
+
+    if (n <= cfg.maxBit) {
+        BitMatrixGraph bm(n);
+        for (const auto &e : edges) {
+            bm.setEdge(e.first, e.second);
+        }
+        results.push_back(measure(cfg, n, "bitmatrix", "bfs", 1, m, [&] { bm.BFS(start); }));
+        results.push_back(measure(cfg, n, "bitmatrix", "transpose", 1, m, [&] { bm.getTranspose(); }));
+        results.push_back(measure(cfg, n, "bitmatrix", "square", 1, m, [&] { bm.squareGraph(); }));
+        results.push_back(measure(cfg, n, "bitmatrix", "sink", 1, m, [&] { bm.findUniversalSink(); }));
+    }
+    return true;
+}
+
+// Масштабирование параллельных алгоритмов по числу потоков
+static bool runScaling(const BenchConfig &cfg, const EdgeList &edges,
+                       std::vector<BenchResult> &results) {
+    int n = cfg.vertices;
+    CsrGraph g = CsrGraph::fromEdges(n, edges);
+    size_t m = g.numEdges();
+    int start = 0;
+    std::vector<int> reference = topDownBFS(g, start).distance;
+    results.push_back(measure(cfg, n, "list", "build_add_edge", 1, m, [&] {
+        Graph built(n);
+        for (const auto &e : edges) {
+            built.addEdge(e.first, e.second);
+        }
+    }));
+    results.push_back(measure(cfg, n, "csr", "bfs_top_down", 1, m, [&] { topDownBFS(g, start); }));
+    for (int t : cfg.threads) {
+        ThreadPool pool(t);
+        if (CsrGraph::fromEdges(n, edges, EdgeBuildOptions(), &pool).getTargets() != g.getTargets()) {
+            std::cerr << "Ошибка: параллельное построение CSR дало другой граф" << std::endl;
+            return false;
+        }
+        results.push_back(measure(cfg, n, "csr", "build_parallel", pool.size(), m,
+                                  [&] { CsrGraph::fromEdges(n, edges, EdgeBuildOptions(), &pool); }));
+        results.push_back(measure(cfg, n, "list", "build_parallel", pool.size(), m,
+                                  [&] { Graph::fromEdges(n, edges, EdgeBuildOptions(), &pool); }));
+        if (parallelBFS(g, start, pool).distance != reference) {
+            std::cerr << "Ошибка: расстояния параллельного BFS не совпадают" << std::endl;
+            return false;
+        }
+        results.push_back(measure(cfg, n, "csr", "bfs_parallel", pool.size(), m,
+                                  [&] { parallelBFS(g, start, pool); }));
+        results.push_back(measure(cfg, n, "csr", "square_parallel", pool.size(), m,
+                                  [&] { parallelSquareGraph(g, pool); }));
+        results.push_back(measure(cfg, n, "csr", "degree_stats_parallel", pool.size(), m,
+                                  [&] { computeDegreeStats(g, DegreeStatsRequest(), &pool); }));
+    }
+    return true;
+}
+
+// BFS, транспонирование и квадрат CSR до и после перенумерации вершин.
+// Время самой перенумерации (порядок + перестроение) — операция reorder.
+static bool runReorder(const BenchConfig &cfg, const EdgeList &edges,
+                       std::vector<BenchResult> &results) {
+    int n = cfg.vertices;
+    CsrGraph g = CsrGraph::fromEdges(n, edges);
+    size_t m = g.numEdges();
+    const VertexOrdering orderings[] = {VertexOrdering::Identity, VertexOrdering::DegreeDescending,
+                                        VertexOrdering::Bfs, VertexOrdering::ReverseCuthillMcKee};
+    std::vector<int> reference = topDownBFS(g, 0).distance;
+    for (VertexOrdering ordering : orderings) {
+        std::string name = std::string("csr_") + orderingName(ordering);
+        VertexPermutation p = computeOrdering(g, ordering);
+        CsrGraph r = relabel(g, p);
+        int start = p.toNew(0);
+        if (toOriginal(topDownBFS(r, start), p).distance != reference) {
+            std::cerr << "Ошибка: расстояния после перенумерации не совпадают" << std::endl;
+            return false;
+        }
+        results.push_back(measure(cfg, n, name, "reorder", 1, m,
+                                  [&] { relabel(g, computeOrdering(g, ordering)); }));
+        results.push_back(measure(cfg, n, name, "bfs", 1, m, [&] { topDownBFS(r, start); }));
+        results.push_back(measure(cfg, n, name, "transpose", 1, m, [&] { r.getTranspose(); }));
+        results.push_back(measure(cfg, n, name, "square", 1, m, [&] { r.squareGraph(); }));
+    }
+    return true;
+}
+
+// Сильно связные компоненты: последовательные алгоритмы служат эталоном
+// для параллельного
+static bool runScc(const BenchConfig &cfg, const EdgeList &edges,
+                   std::vector<BenchResult> &results) {
+    int n = cfg.vertices;
+    CsrGraph g = CsrGraph::fromEdges(n, edges);
+    CsrGraph gT = g.getTranspose();
+    size_t m = g.numEdges();
+    SccResult reference = tarjanSCC(g);
+    if (!sameComponents(kosarajuSCC(g, gT), reference)) {
+        std::cerr << "Ошибка: компоненты Косарайю и Тарьяна не совпадают" << std::endl;
+        return false;
+    }
+    {
+        Graph list = g.toGraph();
+        results.push_back(measure(cfg, n, "list", "scc_kosaraju", 1, m, [&] { kosarajuSCC(list); }));
+        results.push_back(measure(cfg, n, "list", "scc_tarjan", 1, m, [&] { tarjanSCC(list); }));
+    }
+    results.push_back(measure(cfg, n, "csr", "scc_kosaraju", 1, m, [&] { kosarajuSCC(g, gT); }));
+    results.push_back(measure(cfg, n, "csr", "scc_tarjan", 1, m, [&] { tarjanSCC(g); }));
+    results.push_back(measure(cfg, n, "csr", "condensation", 1, m, [&] { condensation(g, reference); }));
+    for (int t : cfg.threads) {
+        ThreadPool pool(t);
+        if (!sameComponents(parallelSCC(g, gT, pool), reference)) {
+            std::cerr << "Ошибка: компоненты параллельного алгоритма не совпадают" << std::endl;
+            return false;
+        }
+        results.push_back(measure(cfg, n, "csr", "scc_parallel", pool.size(), m,
+                                  [&] { parallelSCC(g, gT, pool); }));
+        results.push_back(measure(cfg, n, "csr", "condensation_parallel", pool.size(), m,
+                                  [&] { condensation(g, reference, &pool); }));
+    }
+    return true;
+}
+
+// Генерация графа потоком в CSR для каждого числа потоков; граф,
+// построенный на первом числе потоков, служит эталоном для остальных
+static bool runGenerate(const BenchConfig &cfg, std::vector<BenchResult> &results) {
+    int n = cfg.vertices;
+    std::uint64_t m = static_cast<std::uint64_t>(n) * cfg.degree;
+    auto generate = [&](ThreadPool &pool) {
+        if (cfg.model == "rmat") {
+            return rmatGraph(n, m, rmatParams(cfg), cfg.seed, EdgeBuildOptions(), &pool);
+        }
+        if (cfg.model == "ba") {
+            return barabasiAlbertGraph(n, cfg.degree, cfg.seed, EdgeBuildOptions(), &pool);
+        }
+        return erdosRenyiGraph(n, m, cfg.seed, true, EdgeBuildOptions(), &pool);
+    };
+    std::string name = "generate_" + cfg.model;
+    std::vector<int> reference;
+    for (int t : cfg.threads) {
+        ThreadPool pool(t);
+        CsrGraph g = generate(pool);
+        if (reference.empty()) {
+            reference = g.getTargets();
+        } else if (g.getTargets() != reference) {
+            std::cerr << "Ошибка: граф " << cfg.model << " зависит от числа потоков" << std::endl;
+            return false;
+        }
+        results.push_back(measure(cfg, n, "csr", name, pool.size(), m, [&] { generate(pool); }));
+    }
+    return true;
+}
+
+// Транспонирование плотной матрицы int в одном буфере
+static bool runTranspose(const BenchConfig &cfg, std::vector<BenchResult> &results) {
+    std::mt19937_64 rng(cfg.seed);
+    for (int n : cfg.sizes) {
+        size_t cells = static_cast<size_t>(n) * n;
+        std::vector<int> src(cells);
+        std::vector<int> dst(cells);
+        for (auto &x : src) {
+            x = static_cast<int>(rng() & 1);
+        }
+        auto naive = [&] {
+            for (int i = 0; i < n; ++i) {
+                for (int j = 0; j < n; ++j) {
+                    dst[static_cast<size_t>(j) * n + i] = src[static_cast<size_t>(i) * n + j];
+                }
+            }
+        };
+        results.push_back(measure(cfg, n, "flat", "transpose_naive", 1, cells, naive));
+        std::vector<int> expected = dst;
+
+        std::fill(dst.begin(), dst.end(), 0);
+        transposeBlocked(src.data(), n, dst.data(), n, n);
+        if (dst != expected) {
+            std::cerr << "Ошибка: блочное транспонирование дало неверный результат" << std::endl;
+            return false;
+        }
+        for (int t : cfg.threads) {
+            ThreadPool pool(t);
+            results.push_back(measure(cfg, n, "flat", "transpose_blocked", pool.size(), cells,
+                                      [&] { transposeBlocked(src.data(), n, dst.data(), n, n, &pool); }));
+            results.push_back(measure(cfg, n, "flat", "transpose_in_place", pool.size(), cells,
+                                      [&] { transposeInPlace(src.data(), n, n, &pool); }));
+        }
+    }
+    return true;
+}
+
+// Печать результатов в формате CSV
+static void printCsv(const BenchConfig &cfg, size_t edges, const std::vector<BenchResult> &results) {
+    std::cout << "# mode=" << cfg.mode << " model=" << cfg.model << " vertices=" << cfg.vertices << " edges=" << edges
+              << " reps=" << cfg.reps << std::endl;
+    std::cout << "vertices,representation,operation,threads,median_ms,p95_ms,edges_per_sec,peak_rss_kb"
+              << std::endl;
+    for (const auto &r : results) {
+        std::cout << r.vertices << "," << r.representation << "," << r.operation << "," << r.threads << ","
+                  << r.medianMs << "," << r.p95Ms << "," << r.edgesPerSec << ","
+                  << r.peakRssKb << std::endl;
+    }
+}
+
+// Печать результатов в формате JSON
+static void printJson(const BenchConfig &cfg, size_t edges, const std::vector<BenchResult> &results) {
+    std::cout << "{\n  \"mode\": \"" << cfg.mode << "\",\n  \"model\": \"" << cfg.model << "\",\n  \"vertices\": " << cfg.vertices
+              << ",\n  \"edges\": " << edges << ",\n  \"reps\": " << cfg.reps
+              << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        std::cout << "    {\"vertices\": " << r.vertices << ", \"representation\": \"" << r.representation << "\", \"operation\": \""
+                  << r.operation << "\", \"threads\": " << r.threads << ", \"median_ms\": "
+                  << r.medianMs << ", \"p95_ms\": " << r.p95Ms << ", \"edges_per_sec\": "
+                  << r.edgesPerSec << ", \"peak_rss_kb\": " << r.peakRssKb << "}"
+                  << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    std::cout << "  ]\n}" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    BenchConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) {
+        return 1;
+    }
+
+    std::vector<BenchResult> results;
+    EdgeList edges;
+    bool ok;
+    if (cfg.mode == "transpose") {
+        ok = runTranspose(cfg, results);
+    } else if (cfg.mode == "generate") {
+        ok = runGenerate(cfg, results);
+    } else {
+        if (!cfg.input.empty()) {
+            // Граф из файла: число вершин — наибольший номер + 1
+            ThreadPool pool;
+            std::string error;
+            int maxVertex = -1;
+            if (!readEdgeListFile(cfg.input, edges, maxVertex, pool, &error)) {
+                std::cerr << "Ошибка чтения " << cfg.input << ": " << error << std::endl;
+                return 1;
+            }
+            cfg.vertices = maxVertex + 1;
+        } else {
+            ThreadPool pool;
+            std::uint64_t m = static_cast<std::uint64_t>(cfg.vertices) * cfg.degree;
+            if (cfg.model == "rmat") {
+                edges = rmatEdges(cfg.vertices, m, rmatParams(cfg), cfg.seed, &pool);
+            } else if (cfg.model == "ba") {
+                edges = barabasiAlbertEdges(cfg.vertices, cfg.degree, cfg.seed, &pool);
+            } else {
+                edges = erdosRenyiEdges(cfg.vertices, m, cfg.seed, true, &pool);
+            }
+        }
+        if (cfg.mode == "scaling") {
+            ok = runScaling(cfg, edges, results);
+        } else if (cfg.mode == "reorder") {
+            ok = runReorder(cfg, edges, results);
+        } else if (cfg.mode == "scc") {
+            ok = runScc(cfg, edges, results);
+        } else {
+            ok = runCompare(cfg, edges, results);
+        }
+    }
+    if (!ok) {
+        return 1;
+    }
+    if (cfg.format == "json") {
+        printJson(cfg, edges.size(), results);
+    } else {
+        printCsv(cfg, edges.size(), results);
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+// main_convert.cpp
+// Преобразование текстового списка рёбер в бинарный файл графа
+// (формат описан в GraphFile.h).
+//
+// Использование:
+//   lab11_convert <входной.txt> <выходной.l11g> [число_вершин]
+//
+// Входной файл: по одному ребру "u v" в строке.  Пустые строки и строки,
+// начинающиеся с '#' или '%', пропускаются; строка "# vertices n" (её
+// пишет writeEdgeList) задаёт число вершин.  Если число вершин не задано
+// ни так, ни аргументом, оно равно максимальному номеру вершины + 1.
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "../include/CsrGraph.h"
+#include "../include/EdgeListReader.h"
+#include "../include/GraphFile.h"
+#include "../include/ThreadPool.h"
+
+int main(int argc, char **argv) {
+    if (argc < 3 || argc > 4) {
+        std::cerr << "Использование: " << argv[0]
+                  << " <входной.txt> <выходной.l11g> [число_вершин]" << std::endl;
+        return 1;
+    }
+
+    int n = 0;
+    if (argc == 4) {
+        n = std::atoi(argv[3]);
+    }
+
+    // Параллельный разбор входного файла
+    ThreadPool pool;
+    CsrGraph g;
+    std::string error;
+    if (!loadCsrGraph(argv[1], g, pool, n, &error)) {
+        std::cerr << "Ошибка чтения: " << error << std::endl;
+        return 1;
+    }
+
+    if (!writeGraphFile(argv[2], g, &error)) {
+        std::cerr << "Ошибка записи: " << error << std::endl;
+        return 1;
+    }
+    std::cout << "Записано вершин: " << g.size() << ", рёбер: " << g.numEdges() << std::endl;
+    return 0;
+}
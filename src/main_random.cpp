@@ -1,39 +1,89 @@
 // main_random.cpp
 // Запуск алгоритмов на случайно сгенерированном графе
 // без ввода данных пользователем.
+//
+// Граф строится генератором из Generator.h, поэтому при одинаковом зерне
+// получается один и тот же граф.  Зерно печатается в начале вывода.
+//
+// Параметры командной строки:
+//   --seed S        зерно (по умолчанию берётся из текущего времени)
+//   --vertices N    число вершин (по умолчанию случайно от 5 до 8)
+//   --edges M       число рёбер (по умолчанию случайно от n до
+//                   min(n(n-1)/2, 8n); для ba — рёбер на вершину,
+//                   по умолчанию 2)
+//   --model M       er (Эрдёш–Реньи, без петель), rmat или ba
+//                   (Барабаши–Альберт); по умолчанию er
+//   --stats [F]     напечатать в конце метрики алгоритмов в формате json
+//                   или prometheus (см. Metrics.h); нужна сборка с
+//                   -DLAB11_METRICS=ON
+//   --dump DIR      записать в каталог DIR граф, транспонированный граф и
+//                   квадрат графа списками рёбер (graph.txt, transpose.txt,
+//                   square.txt — их читают скрипты .py/plot_*.py), а граф
+//                   и его квадрат — бинарными файлами graph.bin и square.bin
+//
+// Граф больше 64 вершин выводится кратко: матрица смежности не строится,
+// а вместо списков смежности печатаются только размеры результатов.
 
+#include <algorithm>
 #include <iostream>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
+#include <string>
 
 #include "../include/Graph.h"
 #include "../include/GraphMatrix.h"
+#include "../include/BfsEngine.h"
+#include "../include/CsrGraph.h"
+#include "../include/DegreeStats.h"
+#include "../include/Generator.h"
+#include "../include/GraphWriter.h"
+#include "../include/SquareEngine.h"
+#include "../include/ThreadPool.h"
+#include "../include/Metrics.h"
+
+// Графы с большим числом вершин печатаются кратко, без матриц смежности
+const int kMaxPrintedVertices = 64;
+
+// Наибольшая средняя степень исхода, когда число рёбер выбирается
+// случайно: без --edges большой граф остаётся разреженным
+const std::uint64_t kMaxDefaultDegree = 8;
 
 // Печать списка смежности
 static void printAdjList(const Graph &g) {
-    const std::vector<std::vector<int>> &adj = g.getAdjacencyList();
-    for (int u = 0; u < g.size(); ++u) {
-        std::cout << u << ": ";
-        for (size_t i = 0; i < adj[u].size(); ++i) {
-            std::cout << adj[u][i];
-            if (i + 1 < adj[u].size()) {
-                std::cout << " ";
-            }
-        }
-        std::cout << std::endl;
-    }
+    OutputBuffer out(std::cout);
+    writeAdjacencyList(out, g, " ");
 }
 
 // Печать матрицы смежности
 static void printAdjMatrix(const GraphMatrix &gm) {
-    const std::vector<std::vector<int>> &mat = gm.getMatrix();
-    int n = gm.size();
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < n; ++j) {
-            std::cout << mat[i][j] << " ";
+    OutputBuffer out(std::cout);
+    writeAdjacencyMatrix(out, gm);
+}
+
+// Печать порядка обхода BFS
+static void printOrder(const std::vector<int> &order) {
+    for (size_t i = 0; i < order.size(); ++i) {
+        std::cout << order[i];
+        if (i + 1 < order.size()) {
+            std::cout << " -> ";
         }
-        std::cout << std::endl;
     }
+    std::cout << std::endl;
+}
+
+// Печать списка вершин через запятую («нет», если список пуст)
+static void printVertices(const std::vector<int> &vertices) {
+    if (vertices.empty()) {
+        std::cout << "нет";
+    }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        std::cout << vertices[i];
+        if (i + 1 < vertices.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << std::endl;
 }
 
 // Печать расстояний BFS
@@ -49,44 +99,14 @@ static void printDistances(const std::vector<int> &dist) {
     }
 }
 
-int main() {
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
-
-    // Количество вершин выбираем случайно из небольшого диапазона
-    int minV = 5;
-    int maxV = 8;
-    int n = minV + std::rand() % (maxV - minV + 1);
-
-    // Максимально возможное число рёбер в ориентированном графе без петель
-    int maxEdges = n * (n - 1);
-
-    // Количество рёбер: от n до примерно половины максимума
-    int minE = n;
-    int maxE = maxEdges / 2;
-    if (maxE < minE) {
-        maxE = minE;
-    }
-    int m = minE + std::rand() % (maxE - minE + 1);
-
-    std::cout << "СЛУЧАЙНЫЙ ГРАФ" << std::endl;
-    std::cout << "Число вершин: " << n << std::endl;
-    std::cout << "Число рёбер:  " << m << std::endl;
-    std::cout << std::endl;
-
-    Graph g(n);
+// Полный вывод для небольшого графа: списки и матрицы смежности всех
+// построенных графов, порядок BFS и степени каждой вершины
+static void runSmall(const Graph &g, const EdgeList &edges, RandomStream &sizes,
+                     ThreadPool &pool) {
+    int n = g.size();
     GraphMatrix gm(n);
-
-    // Заполняем граф случайными рёбрами
-    int added = 0;
-    while (added < m) {
-        int u = std::rand() % n;
-        int v = std::rand() % n;
-        if (u == v) {
-            continue; // без петель
-        }
-        g.addEdge(u, v);
-        gm.setEdge(u, v, 1);
-        added++;
+    for (const auto &e : edges) {
+        gm.setEdge(e.first, e.second, 1);
     }
 
     std::cout << "Списки смежности исходного графа:" << std::endl;
@@ -109,16 +129,35 @@ int main() {
     printAdjMatrix(gmT);
     std::cout << std::endl;
 
+
     // BFS от случайной стартовой вершины
-    int start = std::rand() % n;
+    int start = static_cast<int>(sizes.nextBelow(n));
     std::cout << "Обход в ширину (BFS) от вершины " << start << " (списки):" << std::endl;
-    std::vector<int> distList = g.BFS(start);
-    printDistances(distList);
+    std::vector<int> orderList = g.BFS(start);
+    printOrder(orderList);
     std::cout << std::endl;
 
     std::cout << "Обход в ширину (BFS) от вершины " << start << " (матрица):" << std::endl;
-    std::vector<int> distMat = gm.BFS(start);
-    printDistances(distMat);
+    std::vector<int> orderMat = gm.BFS(start);
+    printOrder(orderMat);
+    std::cout << std::endl;
+
+    std::cout << "Расстояния от вершины " << start << " (BFS с переключением направления):" << std::endl;
+    BfsResult bfs = directionOptimizingBFS(g, start);
+    printDistances(bfs.distance);
+    std::cout << std::endl;
+
+    // Степени вершин и универсальный сток по спискам за один проход
+    DegreeStats stats = computeDegreeStats(g, DegreeStatsRequest(), &pool);
+    std::cout << "Степени вершин (исхода / захода):" << std::endl;
+    for (int v = 0; v < n; ++v) {
+        std::cout << "Вершина " << v << ": " << stats.outDegree[v] << " / " << stats.inDegree[v]
+                  << std::endl;
+    }
+    std::cout << "Источники (нет входящих рёбер): ";
+    printVertices(stats.sources);
+    std::cout << "Стоки (нет исходящих рёбер): ";
+    printVertices(stats.sinks);
     std::cout << std::endl;
 
     // Универсальный сток (по матрице)
@@ -128,6 +167,10 @@ int main() {
     } else {
         std::cout << "Найден универсальный сток: вершина " << sink << std::endl;
     }
+    if (stats.universalSink != sink) {
+        std::cout << "Ошибка: по спискам смежности найден другой сток: " << stats.universalSink
+                  << std::endl;
+    }
     std::cout << std::endl;
 
     // Квадрат графа
@@ -147,6 +190,171 @@ int main() {
     std::cout << "Эквивалентный простой неориентированный граф:" << std::endl;
     printAdjList(gSimple);
     std::cout << std::endl;
+}
+
+// Краткий вывод для большого графа: матрица смежности (n^2 ячеек) не
+// строится, а вместо списков печатаются только размеры результатов
+static void runLarge(const Graph &g, RandomStream &sizes, ThreadPool &pool) {
+    int n = g.size();
+    std::cout << "Граф больше " << kMaxPrintedVertices
+              << " вершин: матрица смежности не строится, выводятся только размеры."
+              << std::endl;
+    std::cout << std::endl;
 
+    Graph gT = g.getTranspose();
+    std::cout << "Транспонированный граф: рёбер " << gT.numEdges() << std::endl;
+    std::cout << std::endl;
+
+
+    int start = static_cast<int>(sizes.nextBelow(n));
+    BfsResult bfs = directionOptimizingBFS(g, start);
+    int reached = 0;
+    int depth = 0;
+    for (int d : bfs.distance) {
+        if (d != -1) {
+            ++reached;
+            depth = std::max(depth, d);
+        }
+    }
+    std::cout << "BFS от вершины " << start << ": достигнуто вершин " << reached
+              << ", наибольшее расстояние " << depth << std::endl;
+    std::cout << std::endl;
+
+    DegreeStats stats = computeDegreeStats(g, DegreeStatsRequest(), &pool);
+    std::cout << "Источников: " << stats.sources.size() << ", стоков: " << stats.sinks.size()
+              << std::endl;
+    if (stats.universalSink == -1) {
+        std::cout << "Универсальный сток в графе отсутствует." << std::endl;
+    } else {
+        std::cout << "Найден универсальный сток: вершина " << stats.universalSink << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Квадрат только подсчитывается, без построения
+    CsrGraph csr = CsrGraph::fromGraph(g);
+    std::cout << "Квадрат графа: рёбер " << countSquareEdges(csr.view(), pool) << std::endl;
+
+    Graph gSimple = g.toSimpleUndirected(&pool);
+    std::cout << "Эквивалентный простой неориентированный граф: рёбер "
+              << gSimple.numEdges() / 2 << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::string statsFormat;
+    std::string dumpDir;
+    std::string model = "er";
+    std::uint64_t seed = static_cast<std::uint64_t>(std::time(nullptr));
+    long long vertices = 0;
+    long long edgeCount = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--stats") {
+            statsFormat = "json";
+            if (i + 1 < argc && (std::string(argv[i + 1]) == "json" ||
+                                 std::string(argv[i + 1]) == "prometheus")) {
+                statsFormat = argv[++i];
+            }
+        } else if (arg == "--dump" && i + 1 < argc) {
+            dumpDir = argv[++i];
+        } else if ((arg == "--seed" || arg == "--vertices" || arg == "--edges" ||
+                    arg == "--model") && i + 1 < argc) {
+            std::string value = argv[++i];
+            if (arg == "--seed") {
+                seed = std::strtoull(value.c_str(), nullptr, 10);
+            } else if (arg == "--vertices") {
+                vertices = std::atoll(value.c_str());
+            } else if (arg == "--edges") {
+                edgeCount = std::atoll(value.c_str());
+            } else {
+                model = value;
+            }
+        } else {
+            std::cerr << "Неизвестный аргумент: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (!statsFormat.empty()) {
+#ifndef LAB11_METRICS
+        std::cerr << "Метрики недоступны: соберите проект с -DLAB11_METRICS=ON." << std::endl;
+#endif
+        Metrics::setEnabled(true);
+        Metrics::setHardwareCounters(true);
+    }
+
+    if (model != "er" && model != "rmat" && model != "ba") {
+        std::cerr << "Неизвестная модель графа: " << model << std::endl;
+        return 1;
+    }
+    if (vertices < 0 || vertices > 1000000000 || edgeCount < 0) {
+        std::cerr << "Неверное число вершин или рёбер." << std::endl;
+        return 1;
+    }
+
+    // Размеры, не заданные явно, выбираются из отдельного потока генератора
+    RandomStream sizes = RandomStream(seed, 0).split(1);
+
+    // Количество вершин выбираем случайно из небольшого диапазона
+    int minV = 5;
+    int maxV = 8;
+    int n = vertices > 0 ? static_cast<int>(vertices)
+                         : minV + static_cast<int>(sizes.nextBelow(maxV - minV + 1));
+    if (n < 2) {
+        n = 2;
+    }
+
+    // Количество рёбер: от n до половины максимума n * (n - 1)
+    // ориентированного графа без петель, но не больше kMaxDefaultDegree
+    // рёбер на вершину
+    std::uint64_t m = static_cast<std::uint64_t>(edgeCount);
+    if (model == "ba") {
+        if (m == 0) {
+            m = 2;
+        }
+    } else if (m == 0) {
+        std::uint64_t minE = n;
+        std::uint64_t maxE = std::min(static_cast<std::uint64_t>(n) * (n - 1) / 2,
+                                      kMaxDefaultDegree * n);
+        maxE = std::max(minE, maxE);
+        m = minE + sizes.nextBelow(maxE - minE + 1);
+    }
+
+    ThreadPool pool;
+    EdgeList edges;
+    if (model == "rmat") {
+        edges = rmatEdges(n, m, RmatParams::graph500(), seed, &pool);
+    } else if (model == "ba") {
+        edges = barabasiAlbertEdges(n, static_cast<int>(m), seed, &pool);
+    } else {
+        edges = erdosRenyiEdges(n, m, seed, false, &pool);
+    }
+
+    std::cout << "СЛУЧАЙНЫЙ ГРАФ" << std::endl;
+    std::cout << "Модель:       " << model << std::endl;
+    std::cout << "Зерно:        " << seed << std::endl;
+    std::cout << "Число вершин: " << n << std::endl;
+    std::cout << "Число рёбер:  " << edges.size() << std::endl;
+    std::cout << std::endl;
+
+    Graph g = Graph::fromEdges(n, edges, EdgeBuildOptions(), &pool);
+    if (!dumpDir.empty()) {
+        std::string error;
+        if (!writeGraphDump(dumpDir, g, &error)) {
+            std::cerr << "Ошибка записи графов: " << error << std::endl;
+            return 1;
+        }
+        std::cout << "Графы записаны в " << dumpDir << std::endl << std::endl;
+    }
+    if (n > kMaxPrintedVertices) {
+        runLarge(g, sizes, pool);
+    } else {
+        runSmall(g, edges, sizes, pool);
+    }
+
+    if (statsFormat == "prometheus") {
+        std::cout << Metrics::toPrometheus();
+    } else if (!statsFormat.empty()) {
+        std::cout << Metrics::toJson();
+    }
     return 0;
 }